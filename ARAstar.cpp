@@ -0,0 +1,201 @@
+#include "Pathfinder.h"
+#include <chrono>
+#include <algorithm>
+#include <climits>
+
+void ARAstar::searchPath()
+{
+    if (startRow < 0 || endRow < 0)
+    {
+        return;
+    }
+
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudgetMs);
+
+    // The scratch memory of every iteration comes from the thread's arena, see SearchArena.h
+    SearchArena::Scope arena;
+    std::pmr::memory_resource *resource = arena.resource();
+
+    // Open set entries hold (key, G score at push time, cell id); outdated entries are skipped when popped
+    typedef std::pair<float, std::pair<int, int>> Entry;
+    std::pmr::vector<Entry> openSet(resource);
+
+    std::pmr::vector<int> gScore(rows * cols, INT_MAX, resource);
+    std::pmr::vector<char> inOpen(rows * cols, 0, resource);
+    std::pmr::vector<char> closed(rows * cols, 0, resource);
+    std::pmr::vector<char> inIncons(rows * cols, 0, resource);
+    std::pmr::vector<int> parents(rows * cols, -1, resource);
+
+    if (trace)
+    {
+        trace->cols = cols;
+    }
+
+    // Nodes improved after being closed, reopened once the weight is lowered
+    std::pmr::vector<int> incons(resource);
+    std::pmr::vector<int> reopened(resource);
+
+    float weight = std::max(1.0f, initialWeight);
+
+    auto heuristic = [&](int id)
+    {
+        return goalHeuristic(id / cols, id % cols);
+    };
+
+    // Cheapest end node reached so far, its G score acts as the goal's G score
+    int goalId = endRow * cols + endCol;
+
+    auto push = [&](int id)
+    {
+        openSet.emplace_back(gScore[id] + weight * heuristic(id), std::make_pair(gScore[id], id));
+        std::push_heap(openSet.begin(), openSet.end(), std::greater<Entry>());
+        inOpen[id] = 1;
+    };
+
+    gScore[startRow * cols + startCol] = 0;
+    push(startRow * cols + startCol);
+
+    bool outOfTime = false;
+    int expansions = 0;
+
+    while (true)
+    {
+        // Expand nodes until the goal's key is the smallest in the open set
+        while (!openSet.empty() && gScore[goalId] > openSet.front().first)
+        {
+            std::pop_heap(openSet.begin(), openSet.end(), std::greater<Entry>());
+            int id = openSet.back().second.second;
+            int pushedG = openSet.back().second.first;
+            openSet.pop_back();
+
+            // Skip entries that were superseded by a better G score
+            if (!inOpen[id] || pushedG != gScore[id])
+            {
+                continue;
+            }
+
+            inOpen[id] = 0;
+            closed[id] = 1;
+
+            Position current(id / cols, id % cols);
+
+            if (trace)
+            {
+                trace->record(SearchTrace::Event::Expand, id);
+            }
+
+            forEachAdjacentNode(current.row, current.col, [&](int row, int col)
+            {
+                int adjId = row * cols + col;
+
+                if (!isWalkable(row, col))
+                {
+                    return;
+                }
+
+                int tentativeGScore = gScore[id] + 1;
+                if (tentativeGScore < gScore[adjId])
+                {
+                    gScore[adjId] = tentativeGScore;
+                    parents[adjId] = id;
+
+                    if (isEndNode(row, col) && tentativeGScore < gScore[goalId])
+                    {
+                        goalId = adjId;
+                    }
+
+                    // Closed nodes wait in the inconsistent list until the next iteration
+                    if (!closed[adjId])
+                    {
+                        push(adjId);
+                    }
+                    else if (!inIncons[adjId])
+                    {
+                        inIncons[adjId] = 1;
+                        incons.push_back(adjId);
+                    }
+                }
+            });
+
+            // Check the clock every few expansions to keep the overhead low
+            // The first pass always runs to the end, so an expired budget still returns a path
+            if (!solutions.empty() && ++expansions % 256 == 0 && std::chrono::steady_clock::now() >= deadline)
+            {
+                outOfTime = true;
+                break;
+            }
+        }
+
+        if (outOfTime || gScore[goalId] == INT_MAX)
+        {
+            return;
+        }
+
+        // The lowest unweighted F score among the open and inconsistent nodes bounds the optimal cost
+        int minFScore = INT_MAX;
+        for (const Entry &entry : openSet)
+        {
+            int id = entry.second.second;
+            if (inOpen[id] && entry.second.first == gScore[id])
+            {
+                minFScore = std::min(minFScore, gScore[id] + heuristic(id));
+            }
+        }
+        for (int id : incons)
+        {
+            minFScore = std::min(minFScore, gScore[id] + heuristic(id));
+        }
+
+        float bound = 1.0f;
+        if (minFScore != INT_MAX)
+        {
+            bound = std::min(weight, std::max(1.0f, static_cast<float>(gScore[goalId]) / minFScore));
+        }
+
+        // Record the current solution if it is better or better bounded than the previous one
+        if (solutions.empty() || gScore[goalId] < solutions.back().cost || bound < solutions.back().bound)
+        {
+            endRow = goalId / cols;
+            endCol = goalId % cols;
+            pathPositions.clear();
+            obtainPath(parents);
+            solutions.push_back({{pathPositions.begin(), pathPositions.end()}, gScore[goalId], bound});
+        }
+
+        if (bound <= 1.0f || std::chrono::steady_clock::now() >= deadline)
+        {
+            return;
+        }
+
+        // Lower the weight, move inconsistent nodes into the open set and recompute every key
+        weight = std::max(1.0f, weight - weightStep);
+
+        reopened.clear();
+        for (const Entry &entry : openSet)
+        {
+            int id = entry.second.second;
+            if (inOpen[id] && entry.second.first == gScore[id])
+            {
+                reopened.push_back(id);
+                inOpen[id] = 0;
+            }
+        }
+        for (int id : incons)
+        {
+            inIncons[id] = 0;
+            reopened.push_back(id);
+        }
+        incons.clear();
+        openSet.clear();
+        std::fill(closed.begin(), closed.end(), 0);
+
+        for (int id : reopened)
+        {
+            if (!inOpen[id])
+            {
+                push(id);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+# Regenerates EmbeddedAssets.cpp from the files in this folder
+# Run it again after changing any of them: python3 Assets/embed_assets.py
+
+import os
+
+ASSETS = [
+    ("UI", "UI.png"),
+    ("UI2", "UI2.png"),
+    ("Cursors", "cursors.png"),
+    ("Tiles", "tiles_1.png"),
+    ("Font", "PressStart2P.ttf"),
+]
+
+here = os.path.dirname(os.path.abspath(__file__))
+out = ["// Generated by Assets/embed_assets.py, do not edit", '#include "EmbeddedAssets.h"', ""]
+
+for name, filename in ASSETS:
+    data = open(os.path.join(here, filename), "rb").read()
+    out.append("// %s, %d bytes" % (filename, len(data)))
+    out.append("static const unsigned char %s_DATA[] = {" % name.upper())
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+
+out.append("namespace EmbeddedAssets")
+out.append("{")
+for name, _ in ASSETS:
+    out.append("    const EmbeddedAsset %s = {%s_DATA, sizeof(%s_DATA)};" % (name, name.upper(), name.upper()))
+out.append("}")
+
+with open(os.path.join(here, "..", "EmbeddedAssets.cpp"), "wb") as f:
+    f.write("\r\n".join(out).encode())
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdlib>
+
+// Bresenham's Line Algorithm is used to efficiently calculate the coordinates of a line between two points.
+// The basic idea behind the algorithm is to determine which pixels should be filled in along the
+// line between two points on a grid
+// visit(x, y) is called for every cell from (x1, y1) to (x2, y2), and the walk stops early if it returns false
+template <typename Visit>
+bool traceLine(int x1, int y1, int x2, int y2, Visit &&visit)
+{
+    // Calculate the differences between the target and current positions
+    int dx = std::abs(x2 - x1);
+    int dy = std::abs(y2 - y1);
+
+    // Determine the directional increments for x and y
+    int sx = (x1 < x2) ? 1 : -1;
+    int sy = (y1 < y2) ? 1 : -1;
+
+    // Error term for linear interpolation
+    int error = dx - dy;
+
+    // Initialize starting positions
+    int x = x1;
+    int y = y1;
+
+    while (true)
+    {
+        if (!visit(x, y))
+        {
+            return false;
+        }
+
+        // Exit loop if the current position matches the target
+        if (x == x2 && y == y2)
+        {
+            return true;
+        }
+
+        // Apply linear interpolation
+        int e2 = 2 * error;
+        if (e2 > -dy)
+        {
+            error -= dy;
+            x += sx;
+        }
+        if (e2 < dx)
+        {
+            error += dx;
+            y += sy;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "Map.h"
+
+// Clearance of a single node from the nodes below and to the right of it
+static int nodeClearance(std::vector<std::vector<Node>> &grid, int row, int col)
+{
+    return cellClearance(grid[row][col].type == Node::NodeType::Wall, row, col, grid.size(), grid[0].size(),
+                         [&](int y, int x) { return grid[y][x].clearance; });
+}
+
+void computeClearance(std::vector<std::vector<Node>> &grid)
+{
+    for (int row = grid.size() - 1; row >= 0; --row)
+    {
+        for (int col = grid[0].size() - 1; col >= 0; --col)
+        {
+            grid[row][col].clearance = nodeClearance(grid, row, col);
+        }
+    }
+}
+
+void updateClearance(std::vector<std::vector<Node>> &grid, int row, int col)
+{
+    // Only squares that can contain (row, col) change, and with the cap their
+    // top-left corner is at most MAX_CLEARANCE - 1 nodes above and to the left
+    int firstRow = std::max(0, row - MAX_CLEARANCE + 1);
+    int firstCol = std::max(0, col - MAX_CLEARANCE + 1);
+
+    for (int y = row; y >= firstRow; --y)
+    {
+        for (int x = col; x >= firstCol; --x)
+        {
+            grid[y][x].clearance = nodeClearance(grid, y, x);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+struct Node;
+
+// Clearance layer for agents bigger than one cell
+// The clearance of a node is the size of the largest wall-free square whose top-left corner is
+// that node, so an agent of size k anchored at (row, col) fits if clearance >= k
+// Values are capped at MAX_CLEARANCE, which keeps the update after a wall edit local
+const int MAX_CLEARANCE = 16;
+
+// Clearance of a cell from the cells below and to the right of it, read with clearanceAt(row, col)
+// Shared by the nodes and by SearchGrids that keep their own walls (see SearchGrid.h)
+template <typename ClearanceAt>
+int cellClearance(bool wall, int row, int col, int rows, int cols, const ClearanceAt &clearanceAt)
+{
+    if (wall)
+    {
+        return 0;
+    }
+
+    int down = row + 1 < rows ? clearanceAt(row + 1, col) : 0;
+    int right = col + 1 < cols ? clearanceAt(row, col + 1) : 0;
+    int diagonal = row + 1 < rows && col + 1 < cols ? clearanceAt(row + 1, col + 1) : 0;
+
+    return std::min(MAX_CLEARANCE, 1 + std::min(down, std::min(right, diagonal)));
+}
+
+// Compute the clearance of every node in the grid
+void computeClearance(std::vector<std::vector<Node>> &grid);
+
+// Recompute the nodes affected by a wall being added or removed at (row, col)
+void updateClearance(std::vector<std::vector<Node>> &grid, int row, int col);
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "CompactPath.h"
+
+// Up, down, left and right, in the same order as Pathfinder::getAdjacentNodes
+static const int DIRECTION_ROW[4] = {-1, 1, 0, 0};
+static const int DIRECTION_COL[4] = {0, 0, -1, 1};
+
+static void writeOffset(std::vector<uint8_t> &codes, int offset)
+{
+    uint32_t value = (uint32_t(offset) << 1) ^ uint32_t(offset >> 31);
+    while (value >= 0x80)
+    {
+        codes.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    codes.push_back(uint8_t(value));
+}
+
+static int readOffset(const std::vector<uint8_t> &codes, size_t &next)
+{
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7)
+    {
+        uint8_t byte = codes[next++];
+        value |= uint32_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            break;
+        }
+    }
+    return int(value >> 1) ^ -int(value & 1);
+}
+
+void CompactPath::push_back(int row, int col)
+{
+    if (count++ == 0)
+    {
+        first = last = std::make_pair(row, col);
+        return;
+    }
+
+    int dRow = row - last.first;
+    int dCol = col - last.second;
+    last = std::make_pair(row, col);
+
+    int direction = -1;
+    for (int d = 0; d < 4; ++d)
+    {
+        if (DIRECTION_ROW[d] == dRow && DIRECTION_COL[d] == dCol)
+        {
+            direction = d;
+        }
+    }
+
+    if (direction == -1)
+    {
+        codes.push_back(0);
+        writeOffset(codes, dRow);
+        writeOffset(codes, dCol);
+        lastRun = SIZE_MAX;
+        return;
+    }
+
+    if (lastRun != SIZE_MAX && codes[lastRun] >> 6 == direction && (codes[lastRun] & MAX_RUN) < MAX_RUN)
+    {
+        ++codes[lastRun];
+        return;
+    }
+
+    lastRun = codes.size();
+    codes.push_back(uint8_t(direction << 6 | 1));
+}
+
+void CompactPath::clear()
+{
+    codes.clear();
+    count = 0;
+    lastRun = SIZE_MAX;
+}
+
+CompactPath::Positions CompactPath::toPositions() const
+{
+    Positions positions;
+    positions.reserve(count);
+    for (const auto &cell : *this)
+    {
+        positions.push_back(cell);
+    }
+    return positions;
+}
+
+// Start the next run, taking its first step, or apply an escaped move
+void CompactPath::Iterator::readCode()
+{
+    uint8_t code = path->codes[next++];
+    int run = code & MAX_RUN;
+
+    if (run == 0)
+    {
+        cell.first += readOffset(path->codes, next);
+        cell.second += readOffset(path->codes, next);
+        return;
+    }
+
+    dRow = DIRECTION_ROW[code >> 6];
+    dCol = DIRECTION_COL[code >> 6];
+    remaining = run - 1;
+    cell.first += dRow;
+    cell.second += dCol;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Path stored as its first cell and runs of steps in one direction, one byte per run of up to
+// 63 steps instead of 8 bytes per cell: the top 2 bits are the direction (up, down, left, right)
+// and the low 6 bits the run length. A zero run length escapes a move that isn't a single step,
+// such as the turning points of ThetaStar, and is followed by the row and column offsets
+// (zigzag LEB128), so any list of cells round-trips unchanged
+class CompactPath
+{
+public:
+    typedef std::vector<std::pair<int, int>> Positions;
+
+    // Streams the cells from the first to the last, decoding one run at a time
+    // Appending to the path invalidates its iterators
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<int, int>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::pair<int, int> *;
+        using reference = const std::pair<int, int> &;
+
+        reference operator*() const { return cell; }
+        pointer operator->() const { return &cell; }
+
+        Iterator &operator++()
+        {
+            ++step;
+            if (remaining > 0)
+            {
+                cell.first += dRow;
+                cell.second += dCol;
+                --remaining;
+            }
+            else if (step < path->count)
+            {
+                readCode();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const { return step == other.step; }
+        bool operator!=(const Iterator &other) const { return step != other.step; }
+
+    private:
+        friend class CompactPath;
+
+        Iterator(const CompactPath *path, size_t step) : path(path), step(step), cell(path->first) {}
+
+        void readCode();
+
+        const CompactPath *path;
+        size_t step;
+        size_t next = 0; // Next code to read
+        int remaining = 0; // Steps left in the current run
+        int dRow = 0;
+        int dCol = 0;
+        std::pair<int, int> cell;
+    };
+
+    CompactPath() = default;
+
+    // Any sequence of (row, col) pairs, such as Pathfinder::pathPositions
+    template <typename Cells>
+    explicit CompactPath(const Cells &positions)
+    {
+        for (const auto &pos : positions)
+        {
+            push_back(pos.first, pos.second);
+        }
+    }
+
+    // Append a cell; a step in the direction of the last run only lengthens that run
+    void push_back(int row, int col);
+
+    void clear();
+
+    // Release the spare capacity left by push_back
+    void shrink_to_fit()
+    {
+        codes.shrink_to_fit();
+    }
+
+    bool empty() const { return count == 0; }
+
+    // Number of cells, the first one included
+    size_t size() const { return count; }
+
+    std::pair<int, int> front() const { return first; }
+    std::pair<int, int> back() const { return last; }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, count); }
+
+    // The path in the format of Pathfinder::pathPositions
+    Positions toPositions() const;
+
+    // Bytes used by the path, the object itself included
+    size_t memoryUsage() const
+    {
+        return sizeof(*this) + codes.capacity();
+    }
+
+private:
+    static const int MAX_RUN = 63;
+
+    std::vector<uint8_t> codes;
+    std::pair<int, int> first{0, 0};
+    std::pair<int, int> last{0, 0};
+    size_t count = 0;
+    size_t lastRun = SIZE_MAX; // Index of the last code if it is a run that can still grow
+};
\ No newline at end of file
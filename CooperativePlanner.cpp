@@ -0,0 +1,364 @@
+#include "CooperativePlanner.h"
+#include <cstdlib>
+
+namespace
+{
+    const int DIRECTIONS[5][2] = {{0, 0}, {-1, 0}, {1, 0}, {0, -1}, {0, 1}}; // Wait first
+}
+
+CooperativePlanner::CooperativePlanner(std::vector<std::vector<Node>> &grid, int window, int replanInterval) :
+    grid(grid), rows(grid.size()), cols(grid.empty() ? 0 : grid[0].size()), window(std::max(window, 1)),
+    replanInterval(replanInterval > 0 ? replanInterval : std::max(window / 2, 1)), occupant(rows * cols, -1)
+{
+}
+
+int CooperativePlanner::addAgent(const Position &start, const Position &goal)
+{
+    if (start.row < 0 || start.row >= rows || start.col < 0 || start.col >= cols ||
+        goal.row < 0 || goal.row >= rows || goal.col < 0 || goal.col >= cols)
+    {
+        return -1;
+    }
+
+    int cell = start.row * cols + start.col;
+    if (grid[start.row][start.col].type == Node::NodeType::Wall || occupant[cell] != -1)
+    {
+        return -1;
+    }
+
+    Agent agent;
+    agent.cell = cell;
+    agent.goal = goal.row * cols + goal.col;
+    agents.push_back(agent);
+
+    int id = agents.size() - 1;
+    occupant[cell] = id;
+    order.push_back(id);
+
+    // Warm the goal search up to the start here, not in the first tick
+    goalBudget = INT_MAX;
+    goalDistance(agents[id], cell);
+    return id;
+}
+
+Position CooperativePlanner::getPosition(int agent) const
+{
+    return Position(agents[agent].cell / cols, agents[agent].cell % cols);
+}
+
+bool CooperativePlanner::hasArrived(int agent) const
+{
+    return agents[agent].cell == agents[agent].goal;
+}
+
+bool CooperativePlanner::allArrived() const
+{
+    for (const Agent &agent : agents)
+    {
+        if (agent.cell != agent.goal)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int CooperativePlanner::reservedBy(int t, int cell) const
+{
+    auto found = reservations.find(uint64_t(t) * (rows * cols) + cell);
+    return found == reservations.end() ? -1 : found->second;
+}
+
+void CooperativePlanner::reserve(int agent, int t, int cell)
+{
+    uint64_t key = uint64_t(t) * (rows * cols) + cell;
+    reservations[key] = agent;
+    agents[agent].reserved.push_back(key);
+}
+
+void CooperativePlanner::release(int agent)
+{
+    for (uint64_t key : agents[agent].reserved)
+    {
+        auto found = reservations.find(key);
+        if (found != reservations.end() && found->second == agent)
+        {
+            reservations.erase(found);
+        }
+    }
+    agents[agent].reserved.clear();
+}
+
+int CooperativePlanner::goalDistance(const Agent &agent, int cell)
+{
+    auto created = goalSearches.emplace(agent.goal, GoalSearch());
+    GoalSearch &search = created.first->second;
+
+    auto heuristic = [&](int id)
+    {
+        return std::abs(id / cols - search.origin / cols) + std::abs(id % cols - search.origin % cols);
+    };
+
+    if (created.second)
+    {
+        search.origin = agent.cell;
+        search.gScore[agent.goal] = 0;
+        search.open.push(std::make_tuple(heuristic(agent.goal), 0, agent.goal));
+    }
+
+    if (search.closed.count(cell))
+    {
+        return search.gScore[cell];
+    }
+
+    while (!search.open.empty())
+    {
+        if (goalBudget <= 0)
+        {
+            return std::abs(cell / cols - agent.goal / cols) + std::abs(cell % cols - agent.goal % cols);
+        }
+        --goalBudget;
+
+        int id = std::get<2>(search.open.top());
+        search.open.pop();
+        if (search.closed.count(id))
+            continue;
+
+        search.closed[id] = 1;
+        int g = search.gScore[id];
+
+        for (int d = 1; d < 5; ++d)
+        {
+            int row = id / cols + DIRECTIONS[d][0];
+            int col = id % cols + DIRECTIONS[d][1];
+            if (row < 0 || row >= rows || col < 0 || col >= cols || grid[row][col].type == Node::NodeType::Wall)
+                continue;
+
+            int next = row * cols + col;
+            auto known = search.gScore.find(next);
+            if (known == search.gScore.end() || g + 1 < known->second)
+            {
+                search.gScore[next] = g + 1;
+                search.open.push(std::make_tuple(g + 1 + heuristic(next), -(g + 1), next));
+            }
+        }
+
+        if (id == cell)
+        {
+            return g;
+        }
+    }
+    return -1;
+}
+
+// Space-time A* from the agent's node over the ticks [time, time + window]
+void CooperativePlanner::planAgent(int id)
+{
+    Agent &agent = agents[id];
+    release(id);
+
+    agent.plan.assign(1, agent.cell);
+    agent.planStart = time;
+    agent.replan = false;
+
+    if (goalDistance(agent, agent.cell) == -1)
+    {
+        // The goal cannot be reached, stay out of the way of nobody and wait
+        reserve(id, time, agent.cell);
+        reserve(id, time + 1, agent.cell);
+        return;
+    }
+
+    struct State
+    {
+        int cell;
+        int step; // Ticks after time
+        int g;
+        int parent;
+        bool exact; // h is the true distance, otherwise the Manhattan distance
+    };
+    std::vector<State> states;
+    std::unordered_map<uint64_t, int> visited; // (step, cell) -> state
+
+    // (f, -g, state), ties go to the deeper state
+    typedef std::tuple<int, int, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    // The true distance is only looked up for states that reach the top of the open list with
+    // their Manhattan estimate, so sidesteps and steps back rarely make the goal search resume
+    auto manhattan = [&](int cell)
+    {
+        return std::abs(cell / cols - agent.goal / cols) + std::abs(cell % cols - agent.goal % cols);
+    };
+
+    states.push_back({agent.cell, 0, 0, -1, true});
+    visited[agent.cell] = 0;
+    open.push(Entry(goalDistance(agent, agent.cell), 0, 0));
+
+    // Bounded by the window: at most window + 1 layers of a small neighbourhood are useful
+    const int maxExpansions = 64 * (window + 1);
+    int found = -1;
+    int expanded = 0;
+
+    while (!open.empty() && expanded < maxExpansions)
+    {
+        int f = std::get<0>(open.top());
+        int index = std::get<2>(open.top());
+        open.pop();
+
+        State current = states[index];
+        if (visited[uint64_t(current.step) * (rows * cols) + current.cell] != index)
+            continue;
+
+        if (!current.exact)
+        {
+            states[index].exact = true;
+            int exactF = current.g + goalDistance(agent, current.cell);
+            if (exactF > f)
+            {
+                open.push(Entry(exactF, -current.g, index));
+                continue;
+            }
+        }
+        ++expanded;
+
+        // The rest of the way is left to the true distance heuristic
+        if (current.step == window)
+        {
+            found = index;
+            break;
+        }
+
+        int t = time + current.step;
+        for (int d = 0; d < 5; ++d)
+        {
+            int row = current.cell / cols + DIRECTIONS[d][0];
+            int col = current.cell % cols + DIRECTIONS[d][1];
+            if (row < 0 || row >= rows || col < 0 || col >= cols || grid[row][col].type == Node::NodeType::Wall)
+                continue;
+
+            int next = row * cols + col;
+
+            // Node taken at the next tick, or an agent coming the other way
+            int holder = reservedBy(t + 1, next);
+            if (holder != -1 && holder != id)
+                continue;
+            int swapper = reservedBy(t, next);
+            if (swapper != -1 && swapper != id && reservedBy(t + 1, current.cell) == swapper)
+                continue;
+
+            // Waiting on the goal is free, so agents that arrived stay there
+            int g = current.g + (d == 0 && current.cell == agent.goal ? 0 : 1);
+            uint64_t key = uint64_t(current.step + 1) * (rows * cols) + next;
+
+            auto seen = visited.find(key);
+            if (seen != visited.end() && states[seen->second].g <= g)
+                continue;
+
+            states.push_back({next, current.step + 1, g, index, false});
+            visited[key] = states.size() - 1;
+            open.push(Entry(g + manhattan(next), -g, states.size() - 1));
+        }
+    }
+    expansions += expanded;
+
+    if (found == -1)
+    {
+        // Boxed in for now: wait, which the agents planned earlier left free, and try again next tick
+        reserve(id, time, agent.cell);
+        reserve(id, time + 1, agent.cell);
+        agent.replan = true;
+        return;
+    }
+
+    agent.plan.assign(window + 1, -1);
+    for (int index = found; index != -1; index = states[index].parent)
+    {
+        agent.plan[states[index].step] = states[index].cell;
+    }
+
+    for (int step = 0; step <= window; ++step)
+    {
+        reserve(id, time + step, agent.plan[step]);
+    }
+}
+
+void CooperativePlanner::invalidate()
+{
+    goalSearches.clear();
+    for (Agent &agent : agents)
+    {
+        agent.replan = true;
+    }
+}
+
+void CooperativePlanner::tick()
+{
+    goalBudget = GOAL_EXPANSIONS_PER_TICK;
+
+    if (time % replanInterval == 0)
+    {
+        reservations.clear();
+        for (Agent &agent : agents)
+        {
+            agent.reserved.clear();
+        }
+
+        if (!order.empty())
+        {
+            std::rotate(order.begin(), order.begin() + 1, order.end());
+        }
+
+        // Every agent keeps its node for the next tick until it has been planned, so it can
+        // always wait there whatever the agents before it decided
+        for (int id : order)
+        {
+            reserve(id, time, agents[id].cell);
+            reserve(id, time + 1, agents[id].cell);
+        }
+
+        for (int id : order)
+        {
+            planAgent(id);
+        }
+    }
+    else
+    {
+        for (int id : order)
+        {
+            if (agents[id].replan)
+            {
+                planAgent(id);
+            }
+        }
+    }
+
+    // Move in priority order; an agent only enters a node that is free right now, so an
+    // agent that could not follow its plan blocks the ones behind it instead of colliding
+    for (int id : order)
+    {
+        Agent &agent = agents[id];
+        int step = time + 1 - agent.planStart;
+        int next = step < int(agent.plan.size()) ? agent.plan[step] : agent.cell;
+
+        if (step >= int(agent.plan.size()) - 1)
+        {
+            agent.replan = true;
+        }
+
+        if (next == agent.cell)
+            continue;
+
+        if (occupant[next] != -1)
+        {
+            agent.replan = true;
+            continue;
+        }
+
+        occupant[agent.cell] = -1;
+        occupant[next] = id;
+        agent.cell = next;
+    }
+
+    ++time;
+}
\ No newline at end of file
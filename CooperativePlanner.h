@@ -0,0 +1,93 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <queue>
+#include <tuple>
+#include <cstdint>
+#include "Pathfinder.h"
+
+// Windowed hierarchical cooperative A* (WHCA*) for many agents on the same grid
+// Agents are planned one after another in priority order; each one runs a space-time A* over
+// the next `window` ticks that avoids the cells, and the swaps, already reserved by the agents
+// planned before it, then reserves its own cells. Beyond the window the search is guided by the
+// true distance to the goal, kept by a resumable search per goal, so once that search has
+// covered an agent's surroundings the cost of a plan depends on the window, not the path length
+// The whole group is replanned every replanInterval ticks, with the priorities rotated so no
+// agent is always last; an agent that cannot follow its plan waits and replans on its own
+// The goal searches are advanced up to each agent's start when it is added, and by at most
+// GOAL_EXPANSIONS_PER_TICK nodes during a tick, so no tick pays for a whole reverse search
+class CooperativePlanner
+{
+public:
+    static const int GOAL_EXPANSIONS_PER_TICK = 2048;
+
+    // replanInterval 0 means half the window
+    CooperativePlanner(std::vector<std::vector<Node>> &grid, int window = 16, int replanInterval = 0);
+
+    // Returns the agent id, or -1 if the start is a wall or taken by another agent
+    int addAgent(const Position &start, const Position &goal);
+
+    // Replan if needed, then move every agent at most one node; agents never share a node
+    // and never swap places
+    void tick();
+
+    // Call after walls were drawn or erased: the goal distances are dropped and every agent replans
+    void invalidate();
+
+    Position getPosition(int agent) const;
+    bool hasArrived(int agent) const;
+    bool allArrived() const;
+
+    int getAgentCount() const { return agents.size(); }
+    int getTime() const { return time; }
+    long long getExpansions() const { return expansions; }
+
+private:
+    struct Agent
+    {
+        int cell;
+        int goal;
+        std::vector<int> plan; // Cell at every tick from planStart to planStart + window
+        int planStart = 0;
+        bool replan = true;
+        std::vector<uint64_t> reserved; // Keys of its entries in the reservation table
+    };
+
+    void planAgent(int agent);
+    void reserve(int agent, int t, int cell);
+    void release(int agent);
+    int reservedBy(int t, int cell) const;
+
+    // Reverse resumable A* (RRA*) from a goal towards the first agent heading there
+    // Its closed nodes have their exact distance to the goal, the abstract heuristic of HCA*;
+    // a query for a node that is not closed yet resumes the search until it is
+    struct GoalSearch
+    {
+        int origin;
+        std::unordered_map<int, int> gScore;
+        std::unordered_map<int, char> closed;
+        std::priority_queue<std::tuple<int, int, int>, std::vector<std::tuple<int, int, int>>, std::greater<std::tuple<int, int, int>>> open; // (f, -g, cell)
+    };
+
+    // Distance from a node to the agent's goal, -1 if the goal cannot be reached from there
+    // Once goalBudget is spent it only returns the Manhattan distance, still a lower bound
+    int goalDistance(const Agent &agent, int cell);
+
+    std::vector<std::vector<Node>> &grid;
+    const int rows;
+    const int cols;
+    const int window;
+    const int replanInterval;
+
+    std::vector<Agent> agents;
+    std::vector<int> order;    // Priority order, first is planned first
+    std::vector<int> occupant; // Agent on every node, -1 if none
+
+    // (absolute tick, cell) -> agent
+    std::unordered_map<uint64_t, int> reservations;
+    std::unordered_map<int, GoalSearch> goalSearches;
+    int goalBudget = INT_MAX; // Goal search expansions left in this tick
+
+    int time = 0;
+    long long expansions = 0;
+};
\ No newline at end of file
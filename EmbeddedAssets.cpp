@@ -0,0 +1,5470 @@
+// Generated by Assets/embed_assets.py, do not edit
+#include "EmbeddedAssets.h"
+
+// UI.png, 1561 bytes
+static const unsigned char UI_DATA[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x4d, 0x08, 0x06, 0x00, 0x00, 0x00, 0xe4, 0x4b, 0x37,
+    0xa5, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x05, 0xd3, 0x49, 0x44, 0x41, 0x54, 0x68, 0x43, 0xed, 0x9b, 0x5d, 0x68, 0x14, 0x57, 0x14, 0xc7,
+    0xcf, 0xc4, 0x26, 0xd1, 0x40, 0x8d, 0x14, 0x35, 0x49, 0x89, 0x21, 0xb1, 0xd0, 0xa4, 0x2d, 0x94,
+    0x92, 0xa0, 0x49, 0xa1, 0x69, 0x51, 0xbb, 0x3e, 0x25, 0x36, 0xd2, 0x87, 0x0a, 0x16, 0xa5, 0x74,
+    0xfb, 0x90, 0xb7, 0x82, 0x4a, 0xe3, 0x43, 0x0b, 0xa5, 0x94, 0xa6, 0x20, 0x05, 0x9f, 0x2c, 0xb8,
+    0x36, 0x54, 0xb0, 0x2d, 0x4a, 0xa9, 0x9a, 0x8f, 0x07, 0xb7, 0x95, 0x92, 0x08, 0x1a, 0x35, 0x81,
+    0x3e, 0xa4, 0x31, 0x3e, 0x58, 0x1b, 0x43, 0x63, 0x42, 0x0a, 0x35, 0x20, 0x8d, 0x11, 0x93, 0x72,
+    0xee, 0xe6, 0x0c, 0x77, 0x66, 0xee, 0xe7, 0xec, 0xce, 0xee, 0x36, 0xec, 0x40, 0x98, 0x9d, 0x99,
+    0x33, 0xf7, 0x9c, 0xdf, 0xfd, 0x9f, 0x73, 0xee, 0xee, 0xec, 0xc6, 0x01, 0x00, 0x48, 0x26, 0x93,
+    0xcb, 0xb8, 0xcf, 0xf4, 0x16, 0x8b, 0xc5, 0x1c, 0x7e, 0xcc, 0x28, 0xfd, 0x38, 0x51, 0x0d, 0x4e,
+    0x00, 0x04, 0x13, 0xb5, 0x9f, 0xb4, 0x41, 0x62, 0xb1, 0x18, 0x8b, 0x39, 0x99, 0x4c, 0x0a, 0x05,
+    0xfd, 0x5f, 0x80, 0x20, 0xc4, 0xf2, 0x81, 0xf7, 0x01, 0x36, 0x6e, 0x06, 0xe7, 0xab, 0x2f, 0x84,
+    0x30, 0x61, 0x41, 0xda, 0x8e, 0x7e, 0xc7, 0x26, 0xa6, 0xa3, 0xe6, 0x91, 0x3b, 0x41, 0xf1, 0xce,
+    0xf7, 0xa4, 0xd9, 0x1f, 0x5a, 0x11, 0x1e, 0x02, 0x36, 0x3d, 0xc3, 0x1c, 0x38, 0x47, 0x8f, 0x04,
+    0x60, 0xc2, 0x80, 0x20, 0xc4, 0xba, 0x57, 0x5e, 0x64, 0x63, 0xce, 0x5f, 0x1a, 0x82, 0x27, 0x7f,
+    0x5e, 0x60, 0xaf, 0xf7, 0xbd, 0xbd, 0x1f, 0x64, 0x30, 0xa1, 0x40, 0x10, 0x22, 0x1e, 0x8f, 0xc3,
+    0xc9, 0xf5, 0x9b, 0x80, 0x20, 0x98, 0xa7, 0x86, 0x7a, 0x70, 0xf6, 0xee, 0xf1, 0xc0, 0xd8, 0x82,
+    0xf0, 0x10, 0x34, 0xfd, 0x26, 0x30, 0xd6, 0x20, 0x04, 0x51, 0x55, 0x55, 0x05, 0xf8, 0xd7, 0xf9,
+    0xe0, 0x61, 0xca, 0x5f, 0x43, 0x7d, 0x6a, 0x3f, 0x74, 0xd5, 0x93, 0x66, 0x36, 0x20, 0x22, 0x08,
+    0x11, 0x8c, 0xe3, 0x38, 0x01, 0xe5, 0xad, 0x40, 0x10, 0xa2, 0xef, 0xd8, 0x6b, 0x30, 0xfc, 0x60,
+    0x07, 0x83, 0xa0, 0xad, 0xb3, 0xaa, 0xda, 0x85, 0x80, 0xb9, 0x59, 0x70, 0x4e, 0x9f, 0x72, 0x1d,
+    0x99, 0x82, 0xa8, 0x20, 0xfc, 0x30, 0x37, 0xaf, 0xdc, 0x80, 0x6d, 0xad, 0xdb, 0x3d, 0x30, 0xc6,
+    0x20, 0x04, 0xd1, 0xfc, 0xc2, 0x2d, 0x28, 0xaf, 0x7b, 0x0e, 0x12, 0xbf, 0x1e, 0x64, 0xe3, 0x37,
+    0x36, 0x36, 0xb2, 0x7d, 0xf3, 0xd9, 0x0b, 0xe0, 0x87, 0xc0, 0xf3, 0x26, 0x20, 0x26, 0x10, 0x3c,
+    0xcc, 0xf7, 0x1f, 0xc7, 0xe1, 0x9d, 0x0f, 0xbc, 0x29, 0x6c, 0x04, 0xe2, 0x87, 0xa0, 0x41, 0x47,
+    0xe7, 0x8f, 0xb3, 0x97, 0xfd, 0xfd, 0xfd, 0x30, 0x3d, 0x3d, 0x0d, 0x89, 0x44, 0xc2, 0xba, 0xd8,
+    0x6d, 0x20, 0xd0, 0x57, 0x59, 0x65, 0x39, 0xdc, 0x3f, 0xdd, 0x07, 0x4b, 0x93, 0x17, 0xed, 0x14,
+    0x91, 0x41, 0x14, 0x97, 0x95, 0x33, 0x88, 0x4f, 0x4e, 0x35, 0x4b, 0x21, 0x4c, 0x14, 0x41, 0x90,
+    0xc7, 0xb3, 0x7f, 0xc3, 0xfa, 0xdd, 0xad, 0x6e, 0xaa, 0xca, 0x5e, 0x20, 0xc4, 0xdc, 0xe0, 0x18,
+    0xbb, 0xbc, 0x38, 0x78, 0xdc, 0x1c, 0x44, 0x07, 0x31, 0x37, 0x36, 0x0a, 0xc3, 0xe3, 0x0d, 0xd0,
+    0x76, 0xf8, 0x4a, 0xa8, 0x05, 0x31, 0x71, 0xa2, 0x07, 0x0e, 0x7d, 0x78, 0x88, 0x05, 0xd6, 0xf2,
+    0xee, 0xa7, 0x4a, 0x18, 0x15, 0x04, 0xde, 0x2f, 0x4d, 0xad, 0x4c, 0x40, 0xe8, 0x14, 0x41, 0x90,
+    0x1f, 0x7e, 0x3c, 0x03, 0x37, 0x86, 0x46, 0xa3, 0x01, 0xc9, 0x14, 0x84, 0x0a, 0x84, 0x20, 0x28,
+    0x8d, 0x54, 0x30, 0x3a, 0x35, 0x84, 0x8a, 0x64, 0x12, 0xc2, 0x06, 0x04, 0x6d, 0x45, 0x30, 0x26,
+    0x10, 0x01, 0x90, 0x4c, 0x43, 0xd8, 0x82, 0xf0, 0x30, 0x95, 0x07, 0xda, 0x98, 0x58, 0xb2, 0xe2,
+    0xf6, 0x37, 0x04, 0xb7, 0x46, 0x10, 0xe2, 0xd1, 0x9d, 0x63, 0x30, 0x3f, 0xde, 0xcd, 0xd6, 0x09,
+    0xda, 0xa8, 0x3b, 0x99, 0x14, 0xb6, 0xa8, 0xdb, 0xc8, 0xd6, 0x11, 0xf4, 0x77, 0x7d, 0x70, 0x04,
+    0xb6, 0xb5, 0xa6, 0xd6, 0x21, 0x82, 0xb8, 0x3b, 0x71, 0x8f, 0xbd, 0xde, 0xf7, 0xd9, 0x37, 0x6c,
+    0xff, 0x54, 0x6d, 0x5d, 0xa0, 0x43, 0x89, 0xfc, 0x04, 0x40, 0x98, 0x4c, 0x0b, 0xe7, 0x98, 0x6d,
+    0xba, 0x10, 0xba, 0x62, 0x47, 0x98, 0xb3, 0x27, 0xcf, 0x7b, 0xe2, 0xaa, 0xad, 0xdf, 0xc2, 0x8e,
+    0xb7, 0xbf, 0xde, 0xe4, 0x9e, 0x97, 0x7d, 0x44, 0xe0, 0x6f, 0x14, 0x82, 0xa0, 0x41, 0x49, 0xd1,
+    0xa5, 0x94, 0xb4, 0x06, 0x2d, 0x56, 0x34, 0x43, 0x74, 0x4e, 0xb7, 0xb2, 0x93, 0x32, 0x64, 0x4f,
+    0x00, 0x26, 0xc1, 0x4b, 0x41, 0xf0, 0x02, 0xa6, 0x17, 0x6d, 0x98, 0x66, 0xba, 0x75, 0x42, 0x05,
+    0xa1, 0x53, 0x84, 0x83, 0xb5, 0x9a, 0x7d, 0x6d, 0x6a, 0x91, 0x01, 0x0f, 0x53, 0xba, 0xf5, 0xb0,
+    0x74, 0xb1, 0xd3, 0x41, 0x98, 0x82, 0x98, 0x8c, 0xa3, 0xb3, 0xf1, 0xa4, 0x96, 0xc8, 0xd8, 0x56,
+    0x62, 0xff, 0x18, 0xba, 0xd4, 0xd2, 0x05, 0x68, 0x7a, 0xdd, 0xe8, 0x4d, 0xa3, 0xe9, 0x60, 0x22,
+    0xbb, 0xac, 0x81, 0xa0, 0xf3, 0xa8, 0x9e, 0x70, 0x64, 0xf5, 0x71, 0x50, 0x3a, 0xb3, 0x9d, 0x4f,
+    0xf7, 0x7a, 0x1e, 0xa0, 0xe5, 0x53, 0x60, 0xb6, 0xb1, 0x30, 0x90, 0x55, 0x91, 0x5a, 0x51, 0x41,
+    0x98, 0x2e, 0x88, 0xb6, 0x33, 0x2f, 0xb3, 0x5f, 0x3d, 0x5d, 0x4b, 0xa6, 0x08, 0xbe, 0x75, 0x48,
+    0x77, 0x0d, 0x31, 0x59, 0x10, 0x33, 0xe5, 0x47, 0xa8, 0x08, 0x0e, 0xfe, 0xe6, 0xce, 0x5d, 0xf0,
+    0xf3, 0xe5, 0x5f, 0xd2, 0x86, 0x51, 0xad, 0x23, 0x99, 0xf4, 0xa3, 0x05, 0x19, 0x58, 0xbb, 0x36,
+    0x90, 0x96, 0xc5, 0xbd, 0xbd, 0xc6, 0xa9, 0x6d, 0x0a, 0xb2, 0xa1, 0x6b, 0x77, 0x60, 0xcc, 0x73,
+    0xbb, 0x8e, 0x18, 0xfb, 0x91, 0x82, 0x0c, 0x94, 0x96, 0xc2, 0xf8, 0x12, 0xc0, 0x1b, 0xc5, 0x6b,
+    0xa0, 0xba, 0xa4, 0xc4, 0x33, 0xe0, 0xe8, 0xc2, 0x82, 0xe7, 0x58, 0x05, 0xa6, 0x03, 0x41, 0x80,
+    0xc7, 0x7f, 0xcc, 0xc1, 0xc3, 0x1d, 0x5b, 0xa0, 0xb9, 0x72, 0xd1, 0x33, 0xee, 0xc4, 0xb5, 0x27,
+    0x9e, 0x63, 0x15, 0x98, 0x56, 0x91, 0x9b, 0x65, 0x65, 0x42, 0x90, 0x46, 0x4e, 0x29, 0x04, 0x93,
+    0xc1, 0xe8, 0x40, 0x28, 0x85, 0xe1, 0xeb, 0xb7, 0x84, 0x20, 0xf5, 0x2d, 0x6b, 0x5c, 0x18, 0x04,
+    0x93, 0xc1, 0x18, 0x81, 0xd0, 0x48, 0xa4, 0x0c, 0x06, 0x1e, 0x05, 0x08, 0xf9, 0x21, 0x65, 0x30,
+    0xf0, 0x02, 0xc8, 0x4a, 0xcb, 0x74, 0xbb, 0x16, 0xa6, 0x16, 0xbf, 0xa1, 0x2a, 0xa8, 0xc8, 0xe6,
+    0xa2, 0x22, 0x37, 0xe5, 0x54, 0x35, 0x63, 0x93, 0x5a, 0xbc, 0x1f, 0x54, 0x05, 0x15, 0xf9, 0xa7,
+    0x76, 0x9d, 0x9b, 0x72, 0xaa, 0x9a, 0xd1, 0xa6, 0x96, 0xa8, 0x6b, 0xa1, 0x43, 0x3f, 0x08, 0xa6,
+    0xda, 0xd4, 0x62, 0xaa, 0x58, 0x67, 0x97, 0x96, 0xdc, 0x9a, 0x31, 0x05, 0x11, 0x75, 0x2d, 0x1c,
+    0xcb, 0x0f, 0x82, 0xa9, 0x36, 0x7c, 0x3f, 0xd5, 0x7c, 0x36, 0xdc, 0xfd, 0xd7, 0xad, 0x19, 0x6d,
+    0xd7, 0x7a, 0x79, 0xa0, 0x2f, 0xd0, 0x02, 0x7f, 0x6b, 0x6f, 0x87, 0xd4, 0xf7, 0x49, 0xa9, 0xed,
+    0x77, 0x00, 0xcf, 0x31, 0x5f, 0xf8, 0x3a, 0x10, 0xea, 0x5a, 0xe7, 0xe3, 0x5f, 0x06, 0xfc, 0x74,
+    0x24, 0x3e, 0x82, 0xe2, 0xba, 0x8d, 0xee, 0x79, 0xec, 0x6e, 0xfc, 0x31, 0x5f, 0xf8, 0x5a, 0x45,
+    0xd2, 0x5d, 0xdd, 0x75, 0x20, 0x99, 0x5a, 0x78, 0x0b, 0x20, 0xa6, 0x4b, 0x6e, 0x41, 0x11, 0xd3,
+    0x99, 0x5a, 0xb1, 0x2b, 0xa4, 0x96, 0xe9, 0x84, 0xe5, 0x24, 0xb5, 0xba, 0xba, 0xba, 0x58, 0x7c,
+    0x23, 0x23, 0x23, 0xd0, 0xd4, 0xd4, 0xe4, 0xee, 0x67, 0x66, 0x66, 0xa0, 0xa7, 0xa7, 0xc7, 0x34,
+    0x76, 0x8f, 0x9d, 0x08, 0x24, 0x0a, 0x3f, 0x6e, 0x6a, 0xe1, 0xe0, 0x18, 0x30, 0x6e, 0x53, 0x53,
+    0x53, 0x6c, 0x5f, 0x5d, 0x9d, 0xfa, 0xda, 0xb9, 0xa2, 0xa2, 0x82, 0xed, 0xbb, 0xbb, 0xbb, 0xad,
+    0x61, 0xfc, 0x20, 0x51, 0xf9, 0xf1, 0xd4, 0x08, 0xef, 0x84, 0x8f, 0x18, 0x41, 0xc2, 0x40, 0xe0,
+    0x18, 0x32, 0x45, 0x68, 0xd2, 0x32, 0xe5, 0x67, 0xf5, 0x7c, 0x66, 0xc7, 0x19, 0x89, 0xea, 0x49,
+    0x4a, 0xe1, 0x49, 0xa3, 0x75, 0x25, 0x02, 0x14, 0x9e, 0x34, 0x9a, 0x4c, 0x9a, 0x3f, 0xb5, 0x4c,
+    0xee, 0x09, 0x6b, 0x93, 0xb5, 0x62, 0x0f, 0x1b, 0xa0, 0xe9, 0x7d, 0x05, 0x10, 0xd3, 0x99, 0xca,
+    0x56, 0x7a, 0x05, 0x14, 0xa1, 0x5f, 0x8d, 0xae, 0xb4, 0x65, 0x6d, 0xbc, 0x3a, 0xfb, 0x9c, 0x82,
+    0x5c, 0xbe, 0xfa, 0x17, 0x03, 0xd8, 0xf9, 0xea, 0xb3, 0xca, 0x47, 0xa6, 0x08, 0xa1, 0xb3, 0xcd,
+    0x0b, 0x10, 0x15, 0x0c, 0x0f, 0xa1, 0xb1, 0xcb, 0x4a, 0x8b, 0x97, 0x7e, 0x1e, 0xa1, 0x99, 0x16,
+    0x05, 0x69, 0x0a, 0xc1, 0xbf, 0xd7, 0xd2, 0xe6, 0x68, 0x9a, 0x06, 0xca, 0xdf, 0x6b, 0x89, 0x60,
+    0x6c, 0x20, 0xf2, 0x02, 0x64, 0x25, 0x08, 0xb7, 0x06, 0x48, 0x19, 0x95, 0x52, 0xa2, 0x49, 0xcd,
+    0x59, 0x8d, 0xf8, 0x83, 0x11, 0x29, 0x80, 0x30, 0xba, 0x46, 0x40, 0xe3, 0xe4, 0x0d, 0x08, 0xaf,
+    0xcc, 0xc4, 0x9d, 0x49, 0xa8, 0xdf, 0x5a, 0x63, 0x0c, 0x91, 0xd3, 0xd4, 0xf2, 0xff, 0xf7, 0x01,
+    0x29, 0x82, 0x0a, 0xa0, 0x12, 0x22, 0x18, 0xd5, 0x7f, 0x2c, 0xe4, 0x4c, 0x11, 0xf6, 0xe3, 0xfd,
+    0xdb, 0x35, 0xe0, 0x3c, 0x3f, 0xc9, 0xb2, 0xe3, 0xc4, 0x99, 0x6b, 0x6c, 0x4f, 0x4a, 0x10, 0x0c,
+    0x9e, 0xeb, 0xdc, 0xdf, 0xc2, 0xae, 0x2d, 0xff, 0xe4, 0x80, 0xb3, 0x77, 0x59, 0xf9, 0xdf, 0x0a,
+    0x69, 0x36, 0x25, 0xed, 0xed, 0xd2, 0xf6, 0x4b, 0x30, 0x04, 0x82, 0x41, 0xe3, 0xe3, 0x53, 0x04,
+    0xe5, 0xcf, 0xa9, 0x20, 0x72, 0x9a, 0x5a, 0x54, 0x13, 0x08, 0x82, 0x1b, 0x29, 0xc3, 0x3f, 0x03,
+    0xa6, 0x54, 0x62, 0x36, 0x63, 0xf7, 0xa4, 0x6a, 0xe4, 0x14, 0x04, 0x83, 0xbc, 0x78, 0xf0, 0x25,
+    0x06, 0xd1, 0xde, 0x81, 0xcf, 0xd9, 0x21, 0x10, 0x28, 0xa5, 0x1f, 0x5e, 0xeb, 0xfd, 0xfc, 0x69,
+    0x66, 0xb3, 0xe7, 0xdb, 0xb1, 0xfc, 0x49, 0x2d, 0x1e, 0x82, 0x82, 0xf3, 0xd7, 0x80, 0xbf, 0x86,
+    0x08, 0x5a, 0x06, 0x93, 0xf5, 0x62, 0x17, 0x41, 0x50, 0x3a, 0xf1, 0x5d, 0x49, 0xd4, 0xd5, 0x54,
+    0x30, 0x39, 0x05, 0x91, 0xa5, 0x89, 0xac, 0x75, 0xf0, 0x93, 0xe0, 0xbf, 0x37, 0xeb, 0x20, 0x54,
+    0xe4, 0xb8, 0x0f, 0xf3, 0xe5, 0x8e, 0x6c, 0x2d, 0xc9, 0x09, 0x88, 0xb6, 0x59, 0x87, 0x30, 0x28,
+    0x80, 0x58, 0x4e, 0x5a, 0x56, 0x7f, 0x78, 0x66, 0x19, 0x9b, 0x95, 0x79, 0x56, 0x3e, 0xbd, 0x59,
+    0x45, 0x14, 0xd2, 0xf8, 0x3f, 0x48, 0x97, 0x57, 0xd9, 0x7c, 0xec, 0x7f, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// UI2.png, 1472 bytes
+static const unsigned char UI2_DATA[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x4d, 0x08, 0x06, 0x00, 0x00, 0x00, 0xe4, 0x4b, 0x37,
+    0xa5, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0e, 0xc3, 0x00, 0x00, 0x0e, 0xc3, 0x01, 0xc7,
+    0x6f, 0xa8, 0x64, 0x00, 0x00, 0x05, 0x55, 0x49, 0x44, 0x41, 0x54, 0x68, 0x43, 0xed, 0x99, 0x6d,
+    0x6c, 0x14, 0x45, 0x18, 0xc7, 0x9f, 0x23, 0x6a, 0xb4, 0x48, 0x29, 0x35, 0x57, 0xd2, 0x17, 0x6a,
+    0x41, 0x5a, 0x25, 0xa8, 0x91, 0x04, 0x52, 0x2c, 0x91, 0x04, 0x2a, 0x35, 0x7e, 0xf0, 0x9b, 0x12,
+    0xa3, 0x51, 0x09, 0x68, 0xfc, 0x60, 0x8a, 0x8a, 0x02, 0x36, 0xc6, 0x98, 0x18, 0x8d, 0x68, 0x01,
+    0x31, 0xf5, 0x8b, 0x31, 0x25, 0x8d, 0x5a, 0x23, 0x82, 0x89, 0x44, 0x23, 0xda, 0x0a, 0x26, 0x4d,
+    0x5a, 0x5a, 0x0a, 0x94, 0xd6, 0x12, 0xb4, 0x80, 0x56, 0xbd, 0xb4, 0xc1, 0xb3, 0xad, 0x45, 0xad,
+    0x7e, 0x40, 0xab, 0xff, 0xb9, 0x79, 0xf6, 0xe6, 0xf6, 0xfd, 0x6e, 0x6f, 0x6f, 0xcf, 0x7a, 0xbf,
+    0xe4, 0xc9, 0xce, 0xcc, 0xed, 0xed, 0xcc, 0xaf, 0xcf, 0xcc, 0xec, 0xed, 0x36, 0x44, 0xff, 0xf2,
+    0x45, 0x7b, 0xcf, 0x34, 0x8e, 0xe9, 0xe6, 0xf6, 0x75, 0xd5, 0xe2, 0xfa, 0x8c, 0x9f, 0xfd, 0x84,
+    0xfc, 0xba, 0x38, 0xc3, 0x32, 0x7e, 0xf7, 0x33, 0x4b, 0x1e, 0x53, 0x66, 0x5d, 0xdd, 0x4a, 0x11,
+    0x41, 0xe3, 0x29, 0x23, 0x10, 0x68, 0xdc, 0xdd, 0x4c, 0xf9, 0x73, 0xf2, 0xe9, 0xd1, 0x47, 0xee,
+    0xa1, 0xf6, 0xb6, 0x6e, 0xf9, 0x49, 0x9c, 0x54, 0x33, 0xf2, 0xd8, 0xe6, 0x4d, 0xe2, 0x78, 0xed,
+    0xc2, 0xc5, 0xe2, 0x08, 0xb6, 0x3d, 0xd9, 0x20, 0x4b, 0x46, 0x52, 0xce, 0x88, 0x2a, 0x51, 0x90,
+    0x9f, 0x4f, 0xfb, 0xf6, 0x7d, 0x9e, 0xb6, 0xcc, 0x40, 0xa2, 0xb8, 0x74, 0x81, 0x88, 0xc1, 0xfe,
+    0x13, 0xf4, 0xd9, 0xc7, 0x07, 0x44, 0xbc, 0xfa, 0xda, 0xcb, 0xf2, 0x0c, 0x23, 0x29, 0x89, 0x60,
+    0xc0, 0x77, 0xdf, 0xbb, 0x41, 0x93, 0x60, 0x7a, 0x7b, 0x06, 0x3d, 0xcb, 0xb0, 0x04, 0x53, 0xb5,
+    0xe4, 0x46, 0x2a, 0x2b, 0x5f, 0x28, 0xca, 0x76, 0x32, 0x49, 0x8b, 0xb0, 0x44, 0xb8, 0xa8, 0x84,
+    0xc6, 0xc6, 0xc7, 0x64, 0x2b, 0xd1, 0xa2, 0x8a, 0x52, 0x71, 0x7c, 0xf3, 0xad, 0xfd, 0x29, 0xcb,
+    0xe8, 0x25, 0x18, 0xbd, 0x8c, 0xd9, 0xf5, 0x93, 0x12, 0xc1, 0x05, 0x5e, 0x6f, 0x7a, 0x47, 0x48,
+    0x2c, 0x28, 0x2d, 0x17, 0x6d, 0xe7, 0x87, 0xbf, 0xd3, 0x24, 0x4e, 0x0e, 0x9c, 0xa1, 0x8b, 0xbf,
+    0x5e, 0x14, 0xe5, 0x64, 0xb1, 0x92, 0x60, 0x54, 0x99, 0xee, 0xae, 0x01, 0x83, 0x8c, 0x6b, 0x11,
+    0x96, 0xa8, 0x5d, 0x7d, 0x2b, 0xbd, 0xd0, 0xb0, 0x45, 0xb6, 0x12, 0xd5, 0xad, 0xb9, 0x8d, 0x42,
+    0xa1, 0x90, 0x26, 0xb1, 0x75, 0xcb, 0x26, 0xd3, 0x45, 0x6f, 0x87, 0x93, 0x04, 0xc3, 0x32, 0x9d,
+    0xc7, 0x4e, 0xc8, 0x96, 0x38, 0xae, 0x76, 0x2d, 0x55, 0x62, 0x7e, 0x51, 0x81, 0x6c, 0x25, 0xfa,
+    0xfe, 0xc7, 0x0b, 0xe2, 0xd8, 0xfc, 0x6e, 0x2b, 0x45, 0x7f, 0x1a, 0xa1, 0x03, 0xef, 0xb7, 0x18,
+    0x24, 0x9c, 0x76, 0x2d, 0xb7, 0x12, 0x4c, 0x41, 0x41, 0x21, 0x1d, 0x3b, 0xda, 0x41, 0xa3, 0x23,
+    0x91, 0x84, 0xbe, 0x1c, 0x33, 0x62, 0x25, 0x71, 0xf9, 0x15, 0x97, 0xd1, 0xe2, 0xeb, 0x4a, 0x6d,
+    0x25, 0xdc, 0x32, 0x74, 0x66, 0x50, 0x96, 0xec, 0x81, 0xc4, 0xf9, 0x73, 0x5f, 0xd3, 0x35, 0xe1,
+    0x22, 0xd9, 0x12, 0xc7, 0x56, 0xc4, 0x4e, 0x02, 0x44, 0x22, 0x3f, 0xd3, 0x0d, 0x95, 0x4b, 0x52,
+    0x96, 0xc0, 0x0e, 0xd4, 0xd2, 0xdc, 0x4a, 0x1f, 0xee, 0xff, 0xc4, 0x51, 0x86, 0x25, 0xc0, 0x60,
+    0xff, 0x49, 0x43, 0x7f, 0x96, 0x22, 0x6e, 0x24, 0x0e, 0x77, 0x1c, 0xa5, 0xc7, 0xeb, 0x1f, 0x48,
+    0x39, 0x13, 0xa0, 0xba, 0x7a, 0xa9, 0x2c, 0x79, 0xc3, 0x54, 0x24, 0x13, 0x12, 0xc8, 0x06, 0xb6,
+    0x52, 0x00, 0x19, 0xbb, 0xac, 0x38, 0x65, 0x03, 0x18, 0x44, 0x32, 0x95, 0x09, 0x3d, 0x56, 0x32,
+    0x6e, 0x24, 0x40, 0x82, 0x48, 0x50, 0x12, 0x8c, 0x2a, 0x03, 0x01, 0xb7, 0x12, 0x40, 0x13, 0x81,
+    0xc4, 0x44, 0x74, 0x22, 0x63, 0x12, 0xed, 0x87, 0x0e, 0x52, 0x4f, 0xcf, 0x69, 0x59, 0x8b, 0x81,
+    0x7a, 0x77, 0xef, 0x29, 0xda, 0xba, 0xed, 0x45, 0xb1, 0xc5, 0x22, 0x80, 0x93, 0x04, 0xd0, 0xee,
+    0x23, 0x2c, 0x02, 0x2e, 0x5d, 0xfa, 0x4b, 0x1c, 0xd3, 0x21, 0x61, 0x77, 0x1f, 0x41, 0x9f, 0xbb,
+    0xf7, 0xb4, 0xc8, 0x5a, 0x8c, 0x95, 0x2b, 0x6e, 0x11, 0xc7, 0x9a, 0x55, 0xb1, 0x23, 0x70, 0xd3,
+    0xa7, 0xa9, 0x08, 0x08, 0xcd, 0x8a, 0x3d, 0xdc, 0x79, 0xcd, 0x84, 0xd3, 0x0d, 0x11, 0xfd, 0x76,
+    0x75, 0x9e, 0x92, 0xb5, 0xb8, 0x40, 0xb2, 0x7d, 0x25, 0xac, 0x91, 0x79, 0xe1, 0x79, 0xb2, 0x44,
+    0x34, 0xfd, 0xf7, 0xb4, 0xef, 0x6b, 0x02, 0xe0, 0xba, 0x18, 0x3c, 0x07, 0xea, 0xa9, 0xf4, 0x95,
+    0x90, 0x11, 0x46, 0xcd, 0x0c, 0xe4, 0xbc, 0x48, 0x04, 0xfa, 0xa8, 0x8b, 0xc1, 0x73, 0xf8, 0x95,
+    0x89, 0x74, 0xe3, 0xe9, 0x51, 0xd7, 0x0d, 0x99, 0xca, 0x88, 0xaf, 0x9d, 0xb0, 0x04, 0x93, 0xa9,
+    0x7e, 0x72, 0x64, 0x03, 0x33, 0x66, 0x6a, 0xcd, 0x98, 0xc5, 0x6e, 0xba, 0xfd, 0xfe, 0x17, 0xb1,
+    0x14, 0x51, 0x6f, 0x90, 0x7e, 0x92, 0xae, 0x7e, 0x4c, 0x45, 0x70, 0xf1, 0x55, 0xab, 0x6b, 0x7d,
+    0x97, 0x49, 0x67, 0x3f, 0xa6, 0x6b, 0x84, 0x3b, 0xe8, 0xec, 0x38, 0x4c, 0xb5, 0x77, 0xdc, 0x25,
+    0x5b, 0xe3, 0x3c, 0xf3, 0xd4, 0xb3, 0xb2, 0xe4, 0x8c, 0xdd, 0x1a, 0x51, 0xfb, 0xd9, 0xf0, 0xf0,
+    0x66, 0xd9, 0x1a, 0xe7, 0xfe, 0xf5, 0xf7, 0xc9, 0x92, 0x33, 0x96, 0x22, 0x10, 0x98, 0xfc, 0x65,
+    0x8c, 0x8a, 0x4b, 0xca, 0x69, 0xee, 0xdc, 0xf8, 0x8f, 0x49, 0x30, 0x3a, 0x1a, 0x91, 0xa5, 0x18,
+    0x76, 0x62, 0x4e, 0x22, 0x10, 0x18, 0x19, 0xf9, 0x81, 0x6a, 0x6a, 0x6a, 0xa9, 0x6a, 0x51, 0xfc,
+    0x85, 0x35, 0x68, 0x3b, 0x72, 0x48, 0x96, 0x62, 0xd8, 0x89, 0x59, 0xae, 0x91, 0x3f, 0xff, 0x98,
+    0xa2, 0xe3, 0x3d, 0x5d, 0xb2, 0x66, 0xa4, 0xb8, 0xb8, 0x4c, 0x8b, 0x1d, 0xbb, 0x5e, 0x92, 0xad,
+    0xc9, 0x73, 0x76, 0xe8, 0x34, 0xb5, 0x7d, 0xfa, 0x91, 0xac, 0x19, 0xa9, 0x5b, 0x7b, 0xa7, 0x16,
+    0xad, 0x1f, 0xbc, 0x27, 0x5b, 0x8d, 0xb8, 0xda, 0xb5, 0x26, 0x27, 0x27, 0x44, 0xf8, 0xcd, 0xd0,
+    0xb7, 0xe7, 0x44, 0xa4, 0xc2, 0xcc, 0xdf, 0x7e, 0xcd, 0x50, 0xb3, 0xa2, 0xcf, 0x10, 0xa6, 0x17,
+    0x87, 0x57, 0xd4, 0xac, 0xe8, 0x33, 0x84, 0xe9, 0xc5, 0xa1, 0xe2, 0x28, 0x32, 0x35, 0xf5, 0x7b,
+    0x42, 0xe8, 0x17, 0x3a, 0x83, 0xb5, 0x92, 0x97, 0x37, 0x5b, 0x44, 0x2a, 0x32, 0xc3, 0xc3, 0x67,
+    0x13, 0x42, 0xbf, 0xd0, 0x19, 0xac, 0x95, 0x8a, 0x8a, 0x4a, 0x11, 0xaa, 0x4c, 0xec, 0xed, 0x82,
+    0x09, 0x57, 0x5e, 0x95, 0x47, 0xcb, 0xab, 0x6b, 0x4c, 0x77, 0xa4, 0x86, 0xe7, 0x62, 0x6f, 0xe3,
+    0x21, 0x06, 0xb0, 0xbb, 0xa9, 0x24, 0xb3, 0x3d, 0x57, 0x56, 0x2d, 0xa5, 0xd9, 0x57, 0xcf, 0x31,
+    0xdd, 0x91, 0x1a, 0xf7, 0xec, 0x10, 0x47, 0x88, 0x01, 0xec, 0x6e, 0xaa, 0xa0, 0xfa, 0x1d, 0xc7,
+    0xfb, 0x88, 0xd7, 0x27, 0x44, 0xb7, 0xf7, 0x11, 0xaf, 0xfd, 0xfc, 0x3f, 0x17, 0x7b, 0x36, 0x93,
+    0x13, 0xc9, 0x36, 0x66, 0xa6, 0xc8, 0xd3, 0xdb, 0xeb, 0x45, 0x80, 0xdf, 0xe4, 0x7f, 0x67, 0x51,
+    0x7f, 0x68, 0xe3, 0x7a, 0x51, 0x4e, 0x17, 0x7e, 0xf4, 0xa3, 0x89, 0xe0, 0x42, 0xd1, 0xe8, 0x05,
+    0x11, 0xa0, 0xbf, 0xaf, 0x97, 0x4a, 0xca, 0xca, 0x45, 0x3d, 0x1c, 0x9e, 0xaf, 0x75, 0xec, 0x15,
+    0xbf, 0xfa, 0xd1, 0x44, 0x76, 0xbe, 0xd2, 0x24, 0x2e, 0x04, 0x70, 0x61, 0x84, 0x0a, 0x3e, 0x4f,
+    0x07, 0x7e, 0xf5, 0x93, 0x7b, 0xd3, 0xe8, 0x06, 0x96, 0x60, 0x32, 0xd5, 0x4f, 0x8e, 0x6c, 0x20,
+    0xa3, 0x53, 0xcb, 0x4f, 0x32, 0xb6, 0xd8, 0xfd, 0x26, 0xf7, 0x13, 0x25, 0xdb, 0x30, 0x4c, 0x2d,
+    0x3c, 0xec, 0x30, 0x6e, 0x1e, 0x76, 0x9c, 0xce, 0x0f, 0x74, 0x6a, 0x7d, 0x79, 0xa4, 0x57, 0x84,
+    0x3a, 0x48, 0x33, 0xf0, 0x39, 0x9f, 0x1b, 0x34, 0xb6, 0x53, 0xcb, 0x4e, 0x86, 0x25, 0xb2, 0x05,
+    0x83, 0x08, 0xa6, 0xc7, 0x9a, 0xb5, 0x2b, 0x64, 0xcd, 0x5c, 0x46, 0x2f, 0x81, 0xf3, 0xbd, 0x3e,
+    0x73, 0x7b, 0xc5, 0x34, 0x23, 0x76, 0x32, 0xd9, 0x28, 0x01, 0x2c, 0xa7, 0x96, 0x95, 0x4c, 0x36,
+    0x4a, 0x00, 0xdb, 0x35, 0x62, 0x26, 0xc3, 0xf5, 0x6c, 0x92, 0x00, 0xb6, 0x22, 0x40, 0x95, 0x39,
+    0xde, 0xf7, 0x95, 0x26, 0x93, 0x4d, 0x12, 0xc0, 0x20, 0x82, 0xe9, 0xc3, 0xeb, 0x01, 0xf0, 0x74,
+    0xc2, 0xe0, 0x97, 0x2f, 0xbb, 0x49, 0x93, 0xd1, 0x9f, 0xa3, 0xd6, 0x83, 0xc0, 0x34, 0x23, 0xe3,
+    0xd1, 0x71, 0x6d, 0x70, 0x8d, 0xbb, 0xf6, 0x26, 0x64, 0x82, 0x65, 0xd0, 0xce, 0xe7, 0x0c, 0xf4,
+    0x7d, 0x23, 0xbf, 0x19, 0x1c, 0x06, 0x11, 0x4c, 0x99, 0xc2, 0x70, 0xa1, 0x90, 0x51, 0xe1, 0xe9,
+    0xc4, 0xd3, 0x8c, 0x81, 0xc4, 0xcd, 0xcb, 0xae, 0x0f, 0x7c, 0xaa, 0x59, 0xbe, 0xfb, 0x65, 0x11,
+    0x48, 0x01, 0x75, 0xa0, 0xf8, 0x1c, 0xe0, 0x9c, 0x48, 0x24, 0x6a, 0x2b, 0x12, 0xd8, 0x4f, 0x14,
+    0x0c, 0xf2, 0xc1, 0x8d, 0xf5, 0xf4, 0xc4, 0xf6, 0xe7, 0xc5, 0x20, 0xad, 0xa6, 0x0d, 0x8b, 0xee,
+    0x6c, 0x7a, 0x43, 0x9c, 0xcf, 0x72, 0x41, 0x91, 0x20, 0xc2, 0x12, 0x0c, 0xfe, 0xd2, 0x08, 0xc8,
+    0xf0, 0x40, 0x71, 0x84, 0x04, 0x32, 0xc5, 0xd9, 0x02, 0x41, 0xcb, 0x68, 0x22, 0x7a, 0x89, 0xb7,
+    0xf7, 0x36, 0x89, 0xe9, 0x82, 0x80, 0x8c, 0x0a, 0x04, 0xf8, 0x33, 0x9c, 0xc7, 0x04, 0x29, 0x63,
+    0xba, 0x6b, 0xb1, 0x04, 0xc3, 0x83, 0xd6, 0x97, 0x01, 0xca, 0xaa, 0x4c, 0x50, 0x24, 0x2c, 0x76,
+    0xfe, 0x6b, 0xaa, 0x03, 0x75, 0x8b, 0xd5, 0x77, 0x33, 0xb5, 0xd8, 0x73, 0xcf, 0xec, 0xd9, 0x86,
+    0xf8, 0x6b, 0xf9, 0x95, 0x95, 0x4c, 0x65, 0x63, 0x06, 0x41, 0xf4, 0x0f, 0xdd, 0xd9, 0x8a, 0x12,
+    0x8e, 0x5d, 0x73, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// cursors.png, 626 bytes
+static const unsigned char CURSORS_DATA[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x38, 0x08, 0x06, 0x00, 0x00, 0x00, 0x7e, 0x23, 0xe1,
+    0x7b, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x02, 0x2c, 0x49, 0x44, 0x41, 0x54, 0x68, 0x43, 0xed, 0x59, 0xe9, 0xd2, 0xc3, 0x20, 0x08, 0x8c,
+    0xef, 0xff, 0xd0, 0x76, 0x72, 0x98, 0x22, 0x72, 0x2c, 0x68, 0xa7, 0xdf, 0x91, 0xfe, 0xea, 0x34,
+    0xba, 0x2e, 0x0b, 0x12, 0xa0, 0x65, 0xfb, 0xc1, 0x9f, 0x32, 0xc9, 0xad, 0x92, 0xfd, 0xb3, 0x58,
+    0x03, 0x95, 0x19, 0xc0, 0x5a, 0x6b, 0xdd, 0x4a, 0xb9, 0x21, 0xb2, 0x58, 0xbb, 0x81, 0xe2, 0xde,
+    0x34, 0xe0, 0x4e, 0xac, 0x7d, 0x2e, 0x82, 0x19, 0x2c, 0x6a, 0xe0, 0xb0, 0x3f, 0x0d, 0xb8, 0x8a,
+    0x98, 0x85, 0x13, 0x25, 0x77, 0x58, 0xba, 0x9a, 0x98, 0x86, 0x87, 0x90, 0xbb, 0xd9, 0x4c, 0x12,
+    0x13, 0x71, 0xf8, 0x2d, 0xa0, 0x21, 0xe2, 0x91, 0xbb, 0x95, 0xda, 0x37, 0x35, 0x72, 0x89, 0x18,
+    0xeb, 0x70, 0x76, 0x42, 0xd4, 0xd0, 0xac, 0x72, 0x03, 0xb9, 0x04, 0xb1, 0x8b, 0xcb, 0x29, 0x5c,
+    0x33, 0x92, 0x1a, 0xdb, 0x7e, 0xe7, 0xb7, 0x36, 0xa4, 0x1c, 0x73, 0x81, 0xb7, 0x97, 0x2e, 0x1f,
+    0x94, 0x6b, 0x0f, 0x49, 0x3a, 0x0a, 0xdd, 0xd6, 0xc3, 0x54, 0xea, 0x4a, 0xe6, 0x56, 0x7a, 0xb8,
+    0x45, 0x34, 0x8d, 0xa3, 0x81, 0xde, 0xf9, 0x47, 0x23, 0x27, 0x10, 0x95, 0xb0, 0xa6, 0x70, 0x54,
+    0x40, 0x1a, 0x1f, 0xc8, 0x77, 0x23, 0x16, 0x4d, 0xe5, 0xb8, 0xf1, 0xd6, 0x6d, 0x1d, 0xf2, 0x18,
+    0xa2, 0x1c, 0x70, 0x8b, 0xd5, 0x5b, 0x6f, 0x84, 0xcd, 0xfb, 0xc5, 0x78, 0x86, 0xd7, 0x90, 0x60,
+    0xc5, 0x2b, 0xaf, 0x15, 0x0b, 0x8a, 0x7a, 0x9d, 0x72, 0x48, 0xa1, 0xd1, 0x70, 0x9a, 0x5b, 0xbb,
+    0xd8, 0xd0, 0xae, 0xbb, 0x07, 0x2c, 0x90, 0x1b, 0x62, 0xce, 0xc3, 0xa0, 0x69, 0x65, 0x27, 0x07,
+    0xb9, 0x32, 0x02, 0x7a, 0xad, 0x15, 0x5d, 0x19, 0xc1, 0x19, 0x94, 0xd3, 0xb2, 0x77, 0x04, 0x94,
+    0x93, 0x43, 0xf6, 0x76, 0x79, 0xe9, 0x8c, 0xb6, 0x3e, 0xe6, 0x48, 0x86, 0xee, 0xd4, 0x44, 0xc1,
+    0x35, 0xb7, 0xa2, 0xfb, 0xf9, 0x6b, 0xcc, 0x4c, 0x9e, 0xd2, 0xfb, 0xcf, 0x3a, 0x48, 0xbb, 0x10,
+    0x59, 0x9c, 0x65, 0xe4, 0xac, 0x3c, 0x17, 0x21, 0x97, 0xaa, 0x4a, 0x3c, 0xd7, 0x38, 0x05, 0x01,
+    0x1c, 0x26, 0x7f, 0x86, 0x5c, 0x57, 0xee, 0x04, 0x93, 0x2f, 0x5f, 0xee, 0xaa, 0xc7, 0xd5, 0x47,
+    0xca, 0x9e, 0x30, 0xa8, 0x62, 0x44, 0x18, 0x07, 0x22, 0xe7, 0xc5, 0xdb, 0xf5, 0xdc, 0xc3, 0xa2,
+    0x3d, 0xae, 0x79, 0xe9, 0xef, 0x94, 0x02, 0x1e, 0xfc, 0x95, 0x65, 0x9e, 0xb5, 0x5f, 0x21, 0x95,
+    0x53, 0xae, 0x6e, 0xb2, 0x6b, 0x8a, 0xdc, 0xb1, 0x6b, 0x96, 0xd5, 0x4d, 0xc6, 0x29, 0xac, 0xf3,
+    0x8f, 0x29, 0xf7, 0x90, 0x7b, 0xeb, 0xfd, 0x28, 0x37, 0x64, 0xe3, 0xff, 0x12, 0x73, 0xab, 0x06,
+    0x84, 0x61, 0x1c, 0x2f, 0xe6, 0x78, 0xa7, 0xee, 0xad, 0x57, 0xb3, 0x07, 0xd0, 0xa1, 0x0d, 0x7b,
+    0xbd, 0xc3, 0x7e, 0x15, 0xb9, 0xae, 0xd4, 0x0f, 0xbc, 0x3e, 0xd4, 0x59, 0x89, 0x36, 0x72, 0x3d,
+    0x9a, 0x08, 0xe7, 0x00, 0x6b, 0x04, 0x16, 0x21, 0x9a, 0xc2, 0x49, 0x93, 0x03, 0x67, 0x25, 0xcd,
+    0x00, 0xa8, 0xe3, 0xe7, 0xd5, 0xcd, 0x12, 0x72, 0xd6, 0x18, 0xeb, 0x3a, 0x10, 0x22, 0xc7, 0x71,
+    0x96, 0x91, 0x3b, 0x1b, 0xcd, 0xb3, 0xdf, 0x14, 0x42, 0x05, 0x26, 0x47, 0x71, 0xe0, 0xb9, 0x1a,
+    0x12, 0xfc, 0x9f, 0x9a, 0x95, 0x88, 0xf5, 0x3e, 0x1f, 0x8d, 0x7a, 0x04, 0x3f, 0x31, 0x2b, 0x51,
+    0x1b, 0x91, 0x49, 0x72, 0xcb, 0x66, 0x25, 0x94, 0xa0, 0xdb, 0x88, 0x68, 0x0a, 0x32, 0xe5, 0xa6,
+    0x71, 0xcc, 0xb1, 0xab, 0xe7, 0x46, 0xfe, 0xfc, 0x99, 0x95, 0xf0, 0xdc, 0x84, 0x28, 0x88, 0xa4,
+    0x91, 0x28, 0x0e, 0x9c, 0xe7, 0x3c, 0xe0, 0x67, 0x56, 0x62, 0x65, 0x77, 0xf0, 0x96, 0xba, 0x35,
+    0x1d, 0x8a, 0xe3, 0xb9, 0x75, 0xc7, 0x71, 0x53, 0x02, 0xf8, 0x7f, 0x58, 0x18, 0x07, 0x22, 0xe7,
+    0xc5, 0x1b, 0xaf, 0x26, 0x94, 0xf5, 0xcf, 0xac, 0x04, 0x14, 0x72, 0x7e, 0xd9, 0x0b, 0x57, 0xe9,
+    0x16, 0x57, 0x66, 0x77, 0x3a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+
+// tiles_1.png, 850 bytes
+static const unsigned char TILES_DATA[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x22, 0x08, 0x06, 0x00, 0x00, 0x00, 0x0a, 0xcb, 0x1a,
+    0xe3, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x03, 0x0c, 0x49, 0x44, 0x41, 0x54, 0x58, 0x47, 0xdd, 0x98, 0xbd, 0x6b, 0x15, 0x51, 0x10, 0xc5,
+    0xf7, 0x61, 0x63, 0x0a, 0x2d, 0x94, 0xd8, 0xd8, 0xd8, 0x58, 0x08, 0x91, 0x10, 0xd0, 0x42, 0x10,
+    0x2c, 0x6c, 0xac, 0x1e, 0x6a, 0x23, 0x58, 0x09, 0xfa, 0x0f, 0x98, 0xc2, 0x32, 0x85, 0xa5, 0x85,
+    0xfe, 0x03, 0x0a, 0xda, 0x08, 0x56, 0xca, 0xeb, 0x2d, 0x04, 0x41, 0x82, 0x82, 0x04, 0x03, 0x16,
+    0x36, 0x36, 0x36, 0x06, 0x2d, 0x6c, 0x62, 0x13, 0x9e, 0x9c, 0x27, 0x67, 0x73, 0xde, 0xec, 0x9d,
+    0xbd, 0x1f, 0x2f, 0x9b, 0xb7, 0xc9, 0x36, 0xfb, 0x75, 0xef, 0xec, 0xfc, 0xee, 0x9c, 0x99, 0xb9,
+    0xec, 0xa0, 0x3a, 0xe4, 0xc7, 0x00, 0x7c, 0x67, 0x4e, 0x1c, 0x1d, 0xa7, 0x70, 0x7e, 0xff, 0xfd,
+    0x77, 0x50, 0x3a, 0x76, 0xf1, 0xf9, 0x4a, 0xb5, 0x75, 0xe7, 0x73, 0xf0, 0x33, 0xb3, 0xd8, 0xa5,
+    0xc1, 0x1b, 0x97, 0x97, 0xaa, 0xd7, 0xef, 0x37, 0xa7, 0xec, 0xc3, 0x6e, 0x0d, 0xf8, 0xf0, 0xfa,
+    0x52, 0xf0, 0xe3, 0x6b, 0x6f, 0x36, 0x2b, 0xbc, 0xc3, 0x99, 0x8e, 0x9c, 0x5c, 0x38, 0xd2, 0x18,
+    0xfb, 0x6b, 0x7b, 0xa7, 0xe2, 0x73, 0x5c, 0xab, 0xd3, 0x80, 0xe3, 0x41, 0x48, 0x05, 0xd6, 0xb1,
+    0xc7, 0x4f, 0x9d, 0xae, 0xfe, 0xfc, 0xfc, 0x51, 0x79, 0x67, 0x6f, 0x31, 0x00, 0x88, 0x83, 0x90,
+    0xb8, 0x7f, 0x32, 0xfa, 0x34, 0x1f, 0x40, 0x0b, 0x4c, 0xa7, 0x63, 0x70, 0x00, 0xc8, 0x8d, 0x76,
+    0xe7, 0x12, 0xf5, 0xa2, 0xa7, 0x11, 0x9d, 0x25, 0x82, 0x2a, 0x4d, 0x2b, 0xd3, 0x86, 0x44, 0x29,
+    0xc7, 0x90, 0x56, 0x43, 0x12, 0x55, 0x59, 0xea, 0x1c, 0x95, 0xa8, 0x05, 0xd4, 0x7b, 0xce, 0xf9,
+    0x38, 0xfc, 0x30, 0xc9, 0xed, 0xdc, 0x08, 0x5a, 0x59, 0x5a, 0xbf, 0x7b, 0x07, 0x08, 0x07, 0x63,
+    0x90, 0x70, 0xfa, 0xfe, 0xf0, 0xc2, 0xd8, 0x16, 0x14, 0xcc, 0xb5, 0xc0, 0x53, 0x80, 0x5d, 0x56,
+    0x51, 0x46, 0x0d, 0x05, 0x66, 0x2f, 0x23, 0x68, 0x7d, 0x8e, 0x4a, 0x54, 0x27, 0x58, 0xb9, 0xb6,
+    0x55, 0x51, 0x2b, 0x55, 0x5b, 0x45, 0xad, 0x23, 0x5e, 0x91, 0x49, 0x8d, 0xa0, 0x6d, 0x55, 0xa1,
+    0x16, 0xc1, 0x82, 0xe4, 0xb6, 0x89, 0xbd, 0x06, 0x4c, 0xe9, 0x83, 0x31, 0x79, 0xf6, 0xb2, 0x8a,
+    0x7a, 0xd2, 0xf7, 0xfa, 0x60, 0x2c, 0x55, 0xb4, 0xe2, 0x7a, 0x91, 0xa3, 0x8d, 0x3a, 0x07, 0x63,
+    0x46, 0x0f, 0xf2, 0xfb, 0xe4, 0x3e, 0x88, 0x15, 0x67, 0x39, 0x4f, 0x01, 0xce, 0x6d, 0xc8, 0xa5,
+    0x5b, 0xc0, 0x36, 0x5f, 0x92, 0xaa, 0x28, 0xa5, 0xa4, 0x80, 0x57, 0x1f, 0x6d, 0x4f, 0xec, 0xbe,
+    0x7d, 0xb0, 0x50, 0xdb, 0xb7, 0xcf, 0x4a, 0x00, 0xdb, 0xf2, 0x54, 0x65, 0xa7, 0x8b, 0x71, 0xe5,
+    0xe5, 0x56, 0xed, 0xc3, 0xbb, 0xdb, 0x8b, 0x15, 0xee, 0x71, 0x6e, 0x14, 0x19, 0x8e, 0x8a, 0x15,
+    0x83, 0xbb, 0x4f, 0xc7, 0x49, 0x1b, 0xf3, 0x67, 0xf7, 0x06, 0x33, 0x6d, 0xcc, 0xe1, 0x8f, 0xee,
+    0x5b, 0x79, 0xaf, 0x0b, 0x47, 0x18, 0x0f, 0x72, 0x2a, 0x82, 0x1a, 0x29, 0xf6, 0x2b, 0xbb, 0xfb,
+    0xc7, 0x84, 0x2e, 0x01, 0xd5, 0x87, 0x90, 0xf4, 0xe0, 0x0f, 0x01, 0x2d, 0x1c, 0xa3, 0xc6, 0x79,
+    0x78, 0xff, 0xe2, 0xda, 0xb1, 0xdd, 0xcd, 0x76, 0x6a, 0x5e, 0xf5, 0x09, 0x10, 0x3e, 0x53, 0x96,
+    0x21, 0xff, 0x7b, 0x07, 0xa8, 0x69, 0x12, 0x8b, 0x20, 0xde, 0xab, 0x34, 0x09, 0xcb, 0xe7, 0x00,
+    0x6f, 0x14, 0x99, 0x58, 0x92, 0xef, 0x97, 0x44, 0x2d, 0xa8, 0xa6, 0x8a, 0x2d, 0x5e, 0x84, 0xa4,
+    0x44, 0x83, 0x45, 0xe6, 0xe2, 0xe8, 0xd2, 0xd8, 0xcb, 0x3b, 0xdb, 0x90, 0xf7, 0x43, 0xa2, 0xb1,
+    0xd2, 0x6f, 0x5b, 0x8a, 0xe6, 0xa3, 0xe6, 0x62, 0x6b, 0x9b, 0x08, 0x15, 0x1d, 0xdb, 0x07, 0xdb,
+    0xda, 0x45, 0x49, 0x15, 0x8d, 0x29, 0xa8, 0x6d, 0xab, 0xa6, 0x91, 0x6b, 0xec, 0x64, 0xba, 0x6a,
+    0xb2, 0x7d, 0xb0, 0x3b, 0xd9, 0xc9, 0x1c, 0xe6, 0x63, 0x6a, 0xab, 0xf6, 0xf8, 0xec, 0xb2, 0xcb,
+    0xba, 0xfa, 0x6d, 0x23, 0xfb, 0x7f, 0x88, 0x46, 0xf0, 0xcb, 0xc6, 0xab, 0x89, 0xed, 0xf3, 0xcb,
+    0xb7, 0x1a, 0xdf, 0xc8, 0xdd, 0xf5, 0xe4, 0x04, 0xa4, 0x06, 0x24, 0x1c, 0x40, 0xec, 0xc1, 0x77,
+    0x37, 0xd7, 0xd7, 0xeb, 0xdd, 0xc9, 0xd7, 0xd1, 0xee, 0x9f, 0x32, 0x1d, 0x7f, 0x6e, 0xf8, 0xff,
+    0xd7, 0xa0, 0x3a, 0x4d, 0x38, 0x8e, 0x23, 0x24, 0x9e, 0xe3, 0xda, 0x02, 0x5a, 0xdb, 0xb4, 0x49,
+    0xbb, 0xc5, 0x80, 0x21, 0x38, 0x1a, 0x03, 0x24, 0x01, 0x3d, 0x38, 0x8e, 0x85, 0x43, 0x5e, 0x54,
+    0x08, 0xa5, 0x4e, 0xea, 0xd8, 0x94, 0x85, 0x2b, 0x06, 0xc4, 0xc4, 0x94, 0x08, 0xaa, 0x13, 0x5c,
+    0x5d, 0xfb, 0xcc, 0x46, 0x10, 0x91, 0xb2, 0x32, 0xb5, 0x11, 0xa4, 0x0d, 0xd8, 0xf4, 0xae, 0x61,
+    0xb7, 0x08, 0x10, 0x93, 0x4a, 0x72, 0x50, 0x1d, 0xf1, 0xa2, 0xe2, 0x39, 0xe4, 0x01, 0x7a, 0xe3,
+    0xa9, 0x8c, 0x22, 0x40, 0xc0, 0xe5, 0x48, 0x54, 0xf3, 0x42, 0x3f, 0x08, 0x60, 0x2b, 0x51, 0x9b,
+    0x83, 0xb6, 0xd8, 0x30, 0xda, 0x9d, 0x46, 0x50, 0x8b, 0x0c, 0x61, 0xf5, 0x0c, 0xa7, 0x34, 0x07,
+    0x53, 0x01, 0x19, 0x25, 0x85, 0xb4, 0x72, 0xb5, 0x80, 0xf8, 0x56, 0x9b, 0xf4, 0x8b, 0x22, 0x48,
+    0x89, 0x22, 0x8a, 0x21, 0x40, 0x6d, 0x13, 0x39, 0x45, 0xc6, 0x03, 0x9c, 0x4b, 0x91, 0xc9, 0x91,
+    0x68, 0xdb, 0x2a, 0x86, 0xaa, 0xa8, 0x82, 0xce, 0xa5, 0x4d, 0x94, 0x16, 0x19, 0x0f, 0xd4, 0xb6,
+    0x89, 0x10, 0x20, 0xe7, 0x76, 0xde, 0xe8, 0x73, 0x34, 0x7d, 0xd0, 0xc6, 0xfe, 0x03, 0x5b, 0x2e,
+    0x46, 0x5f, 0xb0, 0x0f, 0x49, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+
+// PressStart2P.ttf, 82480 bytes
+static const unsigned char FONT_DATA[] = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x00, 0x03, 0x00, 0x60, 0x46, 0x46, 0x54, 0x4d,
+    0x63, 0x0e, 0xe5, 0x25, 0x00, 0x01, 0x42, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x47, 0x44, 0x45, 0x46,
+    0x02, 0x5e, 0x00, 0x24, 0x00, 0x01, 0x41, 0xec, 0x00, 0x00, 0x00, 0x28, 0x4f, 0x53, 0x2f, 0x32,
+    0xbe, 0x59, 0x91, 0x96, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+    0xd3, 0x2b, 0xa9, 0xe4, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x03, 0xc6, 0x63, 0x76, 0x74, 0x20,
+    0x00, 0x22, 0x02, 0x88, 0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x04, 0x67, 0x61, 0x73, 0x70,
+    0xff, 0xff, 0x00, 0x03, 0x00, 0x01, 0x41, 0xe4, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
+    0xee, 0x36, 0x85, 0x1f, 0x00, 0x00, 0x0e, 0x5c, 0x00, 0x00, 0xed, 0x4c, 0x68, 0x65, 0x61, 0x64,
+    0xfc, 0x8b, 0x90, 0x13, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x08, 0x01, 0x04, 0x05, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+    0x3e, 0x80, 0x32, 0x00, 0x00, 0x00, 0x01, 0xc8, 0x00, 0x00, 0x04, 0x66, 0x6c, 0x6f, 0x63, 0x61,
+    0xb7, 0x8e, 0xf3, 0x1a, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x04, 0x60, 0x6d, 0x61, 0x78, 0x70,
+    0x02, 0x76, 0x00, 0x73, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x76, 0xab, 0xfb, 0xa8, 0x00, 0x00, 0xfb, 0xa8, 0x00, 0x00, 0x37, 0x02, 0x70, 0x6f, 0x73, 0x74,
+    0xf8, 0xf0, 0xf9, 0x8a, 0x00, 0x01, 0x32, 0xac, 0x00, 0x00, 0x0f, 0x37, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0xa9, 0x3a, 0x18, 0xc5, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xb6, 0x25, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xb6, 0x25, 0x8b,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x02, 0x2f, 0x00, 0x70,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x01, 0xf4, 0x00, 0x05,
+    0x00, 0x08, 0x02, 0x99, 0x02, 0xcc, 0x00, 0x00, 0x00, 0x8f, 0x02, 0x99, 0x02, 0xcc, 0x00, 0x00,
+    0x01, 0xeb, 0x00, 0x33, 0x01, 0x09, 0x00, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x02, 0xaf, 0x50, 0x00, 0x60, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x66, 0x45, 0x64, 0x00, 0xc0, 0x00, 0x20, 0xfb, 0x02, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xbc, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x01, 0xa0,
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x40, 0x00, 0x05, 0x00, 0x24, 0x00, 0x7f, 0x01, 0x7f, 0x01, 0x92,
+    0x02, 0xc7, 0x02, 0xcb, 0x02, 0xdd, 0x03, 0x7a, 0x03, 0x7e, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0xa1,
+    0x03, 0xce, 0x04, 0x5f, 0x20, 0x15, 0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30,
+    0x20, 0x3a, 0x20, 0x44, 0x20, 0xac, 0x20, 0xaf, 0x21, 0x16, 0x21, 0x22, 0x21, 0x93, 0x22, 0x02,
+    0x22, 0x06, 0x22, 0x0f, 0x22, 0x11, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60,
+    0x22, 0x65, 0x25, 0xb2, 0x25, 0xb6, 0x25, 0xbc, 0x25, 0xc0, 0x25, 0xca, 0x26, 0x06, 0x26, 0x60,
+    0x26, 0x63, 0x26, 0x66, 0x26, 0x6a, 0xf1, 0x01, 0xf8, 0xff, 0xfb, 0x02, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0xa0, 0x01, 0x92, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xd7, 0x03, 0x7a, 0x03, 0x7e,
+    0x03, 0x84, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0xa3, 0x04, 0x00, 0x20, 0x13, 0x20, 0x18, 0x20, 0x1c,
+    0x20, 0x20, 0x20, 0x26, 0x20, 0x30, 0x20, 0x39, 0x20, 0x44, 0x20, 0xac, 0x20, 0xaf, 0x21, 0x16,
+    0x21, 0x22, 0x21, 0x90, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x11, 0x22, 0x1a, 0x22, 0x1e,
+    0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xb2, 0x25, 0xb6, 0x25, 0xbc, 0x25, 0xc0,
+    0x25, 0xca, 0x26, 0x05, 0x26, 0x60, 0x26, 0x63, 0x26, 0x65, 0x26, 0x6a, 0xf1, 0x00, 0xf8, 0xff,
+    0xfb, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xc3, 0xff, 0xb1, 0xfe, 0x7e, 0xfe, 0x7d, 0xfe, 0x72,
+    0xfd, 0xd6, 0xfd, 0xd3, 0xfd, 0xce, 0xfd, 0xcd, 0xfd, 0xcc, 0xfd, 0xcb, 0xfd, 0x9a, 0xe1, 0xe7,
+    0xe1, 0xe5, 0xe1, 0xe4, 0xe1, 0xe3, 0xe1, 0xe0, 0xe1, 0xd7, 0xe1, 0xcf, 0xe1, 0xc6, 0xe1, 0x5f,
+    0xe1, 0x5d, 0xe0, 0xf7, 0xe0, 0xec, 0xe0, 0x7f, 0xe0, 0x11, 0xe0, 0x0e, 0xe0, 0x06, 0xe0, 0x05,
+    0xdf, 0xfd, 0xdf, 0xfa, 0xdf, 0xee, 0xdf, 0xd2, 0xdf, 0xbb, 0xdf, 0xb8, 0xdc, 0x6c, 0xdc, 0x69,
+    0xdc, 0x64, 0xdc, 0x61, 0xdc, 0x58, 0xdc, 0x1e, 0xdb, 0xc5, 0xdb, 0xc3, 0xdb, 0xc2, 0xdb, 0xbf,
+    0x11, 0x2a, 0x09, 0x2d, 0x07, 0x2c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07,
+    0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
+    0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
+    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
+    0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
+    0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f,
+    0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
+    0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f,
+    0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
+    0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f,
+    0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
+    0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f,
+    0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x87, 0x00, 0x88, 0x00, 0x8a, 0x00, 0x8c, 0x00, 0x94,
+    0x00, 0x99, 0x00, 0x9f, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xa5, 0x00, 0xa7, 0x00, 0xa6, 0x00, 0xa8,
+    0x00, 0xaa, 0x00, 0xac, 0x00, 0xab, 0x00, 0xad, 0x00, 0xae, 0x00, 0xb0, 0x00, 0xaf, 0x00, 0xb1,
+    0x00, 0xb2, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0xb9, 0x00, 0xb8, 0x00, 0xbd,
+    0x00, 0xbc, 0x00, 0xbe, 0x00, 0xbf, 0x02, 0x03, 0x00, 0x73, 0x00, 0x65, 0x00, 0x66, 0x00, 0x6a,
+    0x02, 0x05, 0x00, 0x79, 0x00, 0xa2, 0x00, 0x71, 0x00, 0x6c, 0x02, 0x0e, 0x00, 0x77, 0x00, 0x6b,
+    0x02, 0x1b, 0x00, 0x89, 0x00, 0x9b, 0x02, 0x18, 0x00, 0x74, 0x02, 0x1c, 0x02, 0x1d, 0x00, 0x68,
+    0x00, 0x78, 0x02, 0x13, 0x02, 0x16, 0x02, 0x15, 0x01, 0x8b, 0x02, 0x19, 0x00, 0x6d, 0x00, 0x7d,
+    0x01, 0x74, 0x00, 0xa9, 0x00, 0xbb, 0x00, 0x82, 0x00, 0x64, 0x00, 0x6f, 0x02, 0x17, 0x01, 0x43,
+    0x02, 0x1a, 0x02, 0x14, 0x00, 0x6e, 0x00, 0x7e, 0x02, 0x06, 0x00, 0x63, 0x00, 0x83, 0x00, 0x86,
+    0x00, 0x98, 0x01, 0x15, 0x01, 0x16, 0x01, 0xfa, 0x01, 0xfb, 0x02, 0x00, 0x02, 0x01, 0x01, 0xfd,
+    0x01, 0xfe, 0x00, 0xba, 0x02, 0x22, 0x00, 0xc2, 0x01, 0x3b, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x08,
+    0x02, 0x09, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x04, 0x00, 0x7a, 0x01, 0xff, 0x02, 0x02, 0x02, 0x07,
+    0x00, 0x85, 0x00, 0x8d, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x8b, 0x00, 0x90, 0x00, 0x91, 0x00, 0x92,
+    0x00, 0x8f, 0x00, 0x96, 0x00, 0x97, 0x02, 0x2c, 0x00, 0x95, 0x00, 0x9d, 0x00, 0x9e, 0x00, 0x9c,
+    0x00, 0xf4, 0x01, 0x44, 0x01, 0x4e, 0x00, 0x72, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x00, 0x7b,
+    0x01, 0x4f, 0x01, 0x4d, 0x01, 0x45, 0x00, 0x00, 0x00, 0x22, 0x02, 0x88, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x50, 0x00, 0x6c, 0x00, 0xb8, 0x01, 0x0c, 0x01, 0x84,
+    0x01, 0xd8, 0x01, 0xea, 0x02, 0x1c, 0x02, 0x4c, 0x02, 0x8c, 0x02, 0xae, 0x02, 0xc8, 0x02, 0xda,
+    0x02, 0xec, 0x03, 0x2e, 0x03, 0x74, 0x03, 0x98, 0x03, 0xdc, 0x04, 0x1e, 0x04, 0x58, 0x04, 0x8e,
+    0x04, 0xce, 0x05, 0x00, 0x05, 0x50, 0x05, 0x8e, 0x05, 0xa8, 0x05, 0xca, 0x06, 0x0c, 0x06, 0x2a,
+    0x06, 0x6a, 0x06, 0xa6, 0x06, 0xea, 0x07, 0x28, 0x07, 0x5e, 0x07, 0xa2, 0x07, 0xd8, 0x07, 0xfe,
+    0x08, 0x1e, 0x08, 0x5c, 0x08, 0x7e, 0x08, 0xa2, 0x08, 0xc6, 0x09, 0x0a, 0x09, 0x22, 0x09, 0x54,
+    0x09, 0x86, 0x09, 0xb6, 0x09, 0xe0, 0x0a, 0x24, 0x0a, 0x60, 0x0a, 0xa4, 0x0a, 0xc0, 0x0a, 0xe4,
+    0x0b, 0x1e, 0x0b, 0x50, 0x0b, 0xa0, 0x0b, 0xc8, 0x0c, 0x04, 0x0c, 0x20, 0x0c, 0x60, 0x0c, 0x7c,
+    0x0c, 0x9e, 0x0c, 0xb0, 0x0c, 0xca, 0x0c, 0xfe, 0x0d, 0x2a, 0x0d, 0x4e, 0x0d, 0x78, 0x0d, 0xaa,
+    0x0d, 0xd6, 0x0e, 0x0a, 0x0e, 0x2e, 0x0e, 0x58, 0x0e, 0x82, 0x0e, 0xb6, 0x0e, 0xd6, 0x0f, 0x00,
+    0x0f, 0x20, 0x0f, 0x4c, 0x0f, 0x76, 0x0f, 0xa0, 0x0f, 0xc2, 0x0f, 0xf8, 0x10, 0x1c, 0x10, 0x3c,
+    0x10, 0x64, 0x10, 0x8e, 0x10, 0xbe, 0x10, 0xea, 0x11, 0x1c, 0x11, 0x4e, 0x11, 0x60, 0x11, 0x90,
+    0x11, 0xc0, 0x11, 0xdc, 0x11, 0xdc, 0x11, 0xfc, 0x12, 0x46, 0x12, 0x82, 0x12, 0xcc, 0x13, 0x0c,
+    0x13, 0x26, 0x13, 0x7e, 0x13, 0x9a, 0x14, 0x08, 0x14, 0x34, 0x14, 0x90, 0x14, 0xa6, 0x14, 0xb8,
+    0x15, 0x34, 0x15, 0x46, 0x15, 0x70, 0x15, 0x9c, 0x15, 0xc6, 0x15, 0xf0, 0x16, 0x0a, 0x16, 0x36,
+    0x16, 0x7a, 0x16, 0x8c, 0x16, 0xa4, 0x16, 0xc6, 0x16, 0xf2, 0x17, 0x4c, 0x17, 0xb6, 0x18, 0x24,
+    0x18, 0xa0, 0x18, 0xdc, 0x19, 0x28, 0x19, 0x72, 0x19, 0xc6, 0x1a, 0x1e, 0x1a, 0x6c, 0x1a, 0xb8,
+    0x1a, 0xf6, 0x1b, 0x48, 0x1b, 0x80, 0x1b, 0xb8, 0x1b, 0xfa, 0x1c, 0x36, 0x1c, 0x68, 0x1c, 0x9a,
+    0x1c, 0xcc, 0x1d, 0x04, 0x1d, 0x48, 0x1d, 0x94, 0x1d, 0xd0, 0x1e, 0x0c, 0x1e, 0x4a, 0x1e, 0x94,
+    0x1e, 0xd4, 0x1f, 0x24, 0x1f, 0x6e, 0x1f, 0xa6, 0x1f, 0xde, 0x20, 0x1a, 0x20, 0x54, 0x20, 0x8e,
+    0x20, 0xbc, 0x21, 0x02, 0x21, 0x46, 0x21, 0x8a, 0x21, 0xd0, 0x22, 0x22, 0x22, 0x6a, 0x22, 0xb6,
+    0x22, 0xf8, 0x23, 0x2c, 0x23, 0x6e, 0x23, 0xb0, 0x23, 0xf4, 0x24, 0x3a, 0x24, 0x6a, 0x24, 0x9a,
+    0x24, 0xd2, 0x25, 0x06, 0x25, 0x54, 0x25, 0x96, 0x25, 0xd2, 0x26, 0x0e, 0x26, 0x4c, 0x26, 0x96,
+    0x26, 0xd6, 0x26, 0xfe, 0x27, 0x3e, 0x27, 0x72, 0x27, 0xa6, 0x27, 0xde, 0x28, 0x14, 0x28, 0x52,
+    0x28, 0x80, 0x28, 0xc0, 0x29, 0x08, 0x29, 0x48, 0x29, 0x94, 0x29, 0xe0, 0x2a, 0x30, 0x2a, 0x7c,
+    0x2a, 0xce, 0x2b, 0x02, 0x2b, 0x5a, 0x2b, 0x94, 0x2b, 0xe2, 0x2c, 0x12, 0x2c, 0x64, 0x2c, 0xa0,
+    0x2c, 0xea, 0x2d, 0x22, 0x2d, 0x66, 0x2d, 0x9a, 0x2d, 0xcc, 0x2e, 0x0c, 0x2e, 0x4a, 0x2e, 0x94,
+    0x2e, 0xc6, 0x2f, 0x04, 0x2f, 0x42, 0x2f, 0x8c, 0x2f, 0xca, 0x30, 0x14, 0x30, 0x56, 0x30, 0xa0,
+    0x30, 0xe2, 0x31, 0x2e, 0x31, 0x64, 0x31, 0xa2, 0x31, 0xee, 0x32, 0x32, 0x32, 0x68, 0x32, 0xa0,
+    0x32, 0xcc, 0x32, 0xfc, 0x33, 0x3c, 0x33, 0x7c, 0x33, 0xaa, 0x33, 0xd6, 0x34, 0x10, 0x34, 0x3e,
+    0x34, 0x78, 0x34, 0xb8, 0x34, 0xe6, 0x35, 0x06, 0x35, 0x40, 0x35, 0x84, 0x35, 0xb8, 0x35, 0xf0,
+    0x36, 0x3e, 0x36, 0x84, 0x36, 0xbc, 0x36, 0xe2, 0x37, 0x12, 0x37, 0x3a, 0x37, 0x6a, 0x37, 0x90,
+    0x37, 0xbe, 0x37, 0xe0, 0x38, 0x0a, 0x38, 0x30, 0x38, 0x5e, 0x38, 0x9a, 0x38, 0xcc, 0x39, 0x0a,
+    0x39, 0x3a, 0x39, 0x80, 0x39, 0xb8, 0x39, 0xe6, 0x3a, 0x1c, 0x3a, 0x46, 0x3a, 0x80, 0x3a, 0xba,
+    0x3a, 0xfe, 0x3b, 0x42, 0x3b, 0x8a, 0x3b, 0xd2, 0x3c, 0x0a, 0x3c, 0x46, 0x3c, 0x8e, 0x3c, 0xc2,
+    0x3d, 0x0e, 0x3d, 0x40, 0x3d, 0x90, 0x3d, 0xcc, 0x3e, 0x12, 0x3e, 0x58, 0x3e, 0xa0, 0x3e, 0xe8,
+    0x3f, 0x34, 0x3f, 0x7a, 0x3f, 0xc8, 0x40, 0x16, 0x40, 0x3e, 0x40, 0x6c, 0x40, 0xa0, 0x40, 0xd2,
+    0x40, 0xfc, 0x41, 0x2e, 0x41, 0x72, 0x41, 0xb2, 0x41, 0xe2, 0x42, 0x0e, 0x42, 0x4e, 0x42, 0x8a,
+    0x42, 0xda, 0x43, 0x26, 0x43, 0x68, 0x43, 0xa6, 0x43, 0xe2, 0x44, 0x1a, 0x44, 0x60, 0x44, 0xa8,
+    0x44, 0xe4, 0x45, 0x2c, 0x45, 0x6a, 0x45, 0xac, 0x45, 0xee, 0x46, 0x2a, 0x46, 0x66, 0x46, 0xb0,
+    0x46, 0xfa, 0x47, 0x16, 0x47, 0x48, 0x47, 0x6a, 0x47, 0x8a, 0x47, 0x9c, 0x47, 0xb6, 0x47, 0xd0,
+    0x47, 0xe2, 0x48, 0x02, 0x48, 0x14, 0x48, 0x40, 0x48, 0x62, 0x48, 0x8c, 0x48, 0xb8, 0x48, 0xd0,
+    0x48, 0xf2, 0x49, 0x0c, 0x49, 0x3a, 0x49, 0x80, 0x49, 0x92, 0x49, 0xc4, 0x49, 0xf2, 0x4a, 0x2a,
+    0x4a, 0x6a, 0x4a, 0x9e, 0x4a, 0xf8, 0x4b, 0x3a, 0x4b, 0x78, 0x4b, 0xae, 0x4b, 0xc6, 0x4b, 0xfe,
+    0x4c, 0x24, 0x4c, 0x60, 0x4c, 0x82, 0x4c, 0xba, 0x4c, 0xde, 0x4d, 0x22, 0x4d, 0x58, 0x4d, 0x8a,
+    0x4d, 0xbc, 0x4d, 0xe6, 0x4e, 0x16, 0x4e, 0x32, 0x4e, 0x5c, 0x4e, 0xa6, 0x4e, 0xc2, 0x4e, 0xea,
+    0x4f, 0x2e, 0x4f, 0x7e, 0x4f, 0xb8, 0x50, 0x02, 0x50, 0x3a, 0x50, 0x78, 0x50, 0xae, 0x50, 0xf4,
+    0x51, 0x2e, 0x51, 0x5c, 0x51, 0xb2, 0x51, 0xd8, 0x52, 0x18, 0x52, 0x48, 0x52, 0x88, 0x52, 0xbe,
+    0x53, 0x02, 0x53, 0x2e, 0x53, 0x84, 0x53, 0xa2, 0x53, 0xda, 0x54, 0x1e, 0x54, 0x4a, 0x54, 0x7a,
+    0x54, 0xc4, 0x54, 0xf0, 0x55, 0x1e, 0x55, 0x4c, 0x55, 0x82, 0x55, 0xb6, 0x55, 0xd8, 0x56, 0x0a,
+    0x56, 0x4a, 0x56, 0x9a, 0x56, 0xd0, 0x57, 0x0a, 0x57, 0x3c, 0x57, 0x82, 0x57, 0xbe, 0x58, 0x00,
+    0x58, 0x4e, 0x58, 0x86, 0x58, 0xc2, 0x58, 0xf8, 0x59, 0x20, 0x59, 0x6e, 0x59, 0xb2, 0x59, 0xd6,
+    0x5a, 0x0e, 0x5a, 0x32, 0x5a, 0x6c, 0x5a, 0xa4, 0x5a, 0xd2, 0x5b, 0x1e, 0x5b, 0x5a, 0x5b, 0xa2,
+    0x5b, 0xc6, 0x5c, 0x04, 0x5c, 0x34, 0x5c, 0x6a, 0x5c, 0x82, 0x5c, 0xbe, 0x5c, 0xe4, 0x5d, 0x34,
+    0x5d, 0x76, 0x5d, 0xa8, 0x5d, 0xec, 0x5e, 0x30, 0x5e, 0x60, 0x5e, 0x92, 0x5e, 0xb4, 0x5e, 0xe4,
+    0x5f, 0x00, 0x5f, 0x2a, 0x5f, 0x6e, 0x5f, 0x8a, 0x5f, 0xbe, 0x60, 0x02, 0x60, 0x52, 0x60, 0x76,
+    0x60, 0x98, 0x60, 0xbe, 0x60, 0xec, 0x61, 0x18, 0x61, 0x4a, 0x61, 0x74, 0x61, 0xc0, 0x61, 0xfe,
+    0x62, 0x3a, 0x62, 0x6e, 0x62, 0xae, 0x62, 0xe4, 0x62, 0xfc, 0x63, 0x30, 0x63, 0x62, 0x63, 0xa2,
+    0x63, 0xd8, 0x64, 0x0a, 0x64, 0x56, 0x64, 0x8e, 0x64, 0xb6, 0x64, 0xe8, 0x65, 0x0a, 0x65, 0x36,
+    0x65, 0x52, 0x65, 0x7c, 0x65, 0xa0, 0x65, 0xbc, 0x65, 0xe8, 0x66, 0x2c, 0x66, 0x5c, 0x66, 0x80,
+    0x66, 0xa2, 0x66, 0xc8, 0x66, 0xf6, 0x67, 0x22, 0x67, 0x52, 0x67, 0x7a, 0x67, 0xb4, 0x67, 0xf0,
+    0x68, 0x20, 0x68, 0x62, 0x68, 0xa8, 0x68, 0xe2, 0x69, 0x0a, 0x69, 0x44, 0x69, 0x7a, 0x69, 0xa4,
+    0x69, 0xd8, 0x6a, 0x02, 0x6a, 0x3a, 0x6a, 0x72, 0x6a, 0xa4, 0x6a, 0xf0, 0x6b, 0x34, 0x6b, 0x7c,
+    0x6b, 0xa0, 0x6b, 0xb2, 0x6b, 0xc4, 0x6b, 0xd6, 0x6b, 0xf0, 0x6c, 0x0a, 0x6c, 0x24, 0x6c, 0x4e,
+    0x6c, 0x78, 0x6c, 0xa0, 0x6c, 0xc4, 0x6c, 0xf6, 0x6d, 0x18, 0x6d, 0x3e, 0x6d, 0xc2, 0x6d, 0xf4,
+    0x6e, 0x24, 0x6e, 0x66, 0x6e, 0xba, 0x6f, 0x06, 0x6f, 0x54, 0x6f, 0x7a, 0x6f, 0xae, 0x6f, 0xe2,
+    0x70, 0x16, 0x70, 0x48, 0x70, 0x90, 0x70, 0xc8, 0x70, 0xe4, 0x71, 0x2e, 0x71, 0x56, 0x71, 0x9a,
+    0x71, 0xce, 0x72, 0x18, 0x72, 0x5c, 0x72, 0x9a, 0x72, 0xd6, 0x73, 0x00, 0x73, 0x28, 0x73, 0x52,
+    0x73, 0x7c, 0x73, 0xe6, 0x74, 0x28, 0x74, 0x7a, 0x74, 0xb4, 0x74, 0xe8, 0x75, 0x20, 0x75, 0x62,
+    0x75, 0xa4, 0x75, 0xd6, 0x75, 0xec, 0x76, 0x40, 0x76, 0x72, 0x76, 0xa6, 0x00, 0x03, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x11,
+    0x29, 0x01, 0x19, 0x01, 0x29, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x80,
+    0x80, 0xc0, 0xc0, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0xfe,
+    0x40, 0x02, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80,
+    0xc0, 0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80,
+    0x02, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0xc0,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x17, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x02, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfd, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33,
+    0x00, 0x3b, 0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x01, 0x00,
+    0x02, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x01, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x02, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xfe, 0x80, 0xfe,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80,
+    0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03,
+    0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x03, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xff,
+    0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x11, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x01, 0xc0, 0x01, 0xc0,
+    0xfe, 0x40, 0xfe, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x2f, 0x00, 0x00,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x03, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xc0, 0x40, 0x40,
+    0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x11, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x40,
+    0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x02, 0x80, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x02, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x11,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40,
+    0xfe, 0xc0, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23,
+    0x00, 0x2f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x02, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x02, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x00, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40,
+    0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x01, 0x11, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00,
+    0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40,
+    0x01, 0x40, 0x01, 0x40, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x3d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80,
+    0x03, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x80,
+    0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x01,
+    0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x11, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x01, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0x80, 0x80, 0xfe, 0x40, 0xfe, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x80,
+    0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x1b, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0xfe, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x11, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x01,
+    0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x02, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x02, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x02, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x00, 0x01, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0b,
+    0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0x01, 0xc0, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x00,
+    0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x01, 0x80, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40,
+    0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x04, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40,
+    0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x00, 0x57,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x37,
+    0x00, 0x4f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff,
+    0x00, 0x02, 0xc0, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x02, 0x00, 0x03, 0x80,
+    0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x40, 0x40, 0x40, 0x40, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x00,
+    0x01, 0x11, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x00, 0x37, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xc0, 0x40, 0x40, 0x40, 0x03, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x80,
+    0x03, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x80, 0x02, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x00,
+    0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13,
+    0x00, 0x5b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfd, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x02, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01,
+    0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x63, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13,
+    0x00, 0x63, 0x00, 0x6b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfd, 0x00,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40,
+    0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x47,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x40,
+    0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27,
+    0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40,
+    0xfe, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xc0,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
+    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0,
+    0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40,
+    0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x13, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x47,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x1f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0x80,
+    0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80,
+    0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfd, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfd, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x13, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80,
+    0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe,
+    0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x02,
+    0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b,
+    0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x03, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x02,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80,
+    0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80,
+    0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x00, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33,
+    0x00, 0x3b, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfd, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80,
+    0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x40,
+    0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40,
+    0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x00, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x01, 0x00, 0x80, 0xfe, 0x40,
+    0xfe, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b,
+    0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe,
+    0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x02, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xfe,
+    0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b,
+    0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40,
+    0x01, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13,
+    0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80,
+    0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x11, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x03, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0,
+    0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x00, 0x01, 0x11, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x02, 0x80, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfd, 0x80,
+    0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x02, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x02, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x02, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x43, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x01, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x01, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x11,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x02, 0x80, 0x01, 0x80, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x05, 0x11, 0x3b, 0x01,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x02, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x03, 0x40, 0xc0, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x02, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x03, 0x40, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x01, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x25, 0x11, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x80, 0x80,
+    0x80, 0x01, 0xc0, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x19, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40, 0x01, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02,
+    0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0xc0, 0x80,
+    0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x80, 0x01, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b,
+    0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x80,
+    0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80,
+    0x02, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40,
+    0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x01,
+    0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x40, 0xc0, 0xc0, 0xc0,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0x40, 0xc0, 0xc0, 0xc0,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x00,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x00, 0x27, 0x00, 0x00, 0x13, 0x11, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xc0,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80,
+    0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40,
+    0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0xc0, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x17, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02,
+    0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0xfe, 0x80,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x11, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe,
+    0x80, 0xfe, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x3f,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01,
+    0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x11, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40,
+    0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00,
+    0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x00, 0x01, 0x01, 0x80, 0x03, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x03, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x02, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x01, 0x80, 0x03, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x02, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x01, 0x80, 0x03, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40, 0x01,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x03, 0xc0, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x02, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x11, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x11, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x40, 0x01,
+    0xc0, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40,
+    0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40,
+    0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
+    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x3d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x03, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x80, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80,
+    0x01, 0xc0, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40,
+    0xfe, 0xc0, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0x02, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f,
+    0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0x80, 0xfe, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x02, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80,
+    0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x01, 0xc0,
+    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x02, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x11, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80,
+    0x01, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02,
+    0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01,
+    0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x47, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x80, 0x00, 0x27, 0x00, 0x00, 0x01, 0x11,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x40, 0x01, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x13, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x02,
+    0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xff, 0x00,
+    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
+    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x02, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x02, 0x80,
+    0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe,
+    0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23,
+    0x00, 0x2b, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x80, 0x80, 0x02, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x40, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff,
+    0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40,
+    0xc0, 0xc0, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x40,
+    0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80,
+    0x80, 0x80, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40,
+    0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x11,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff,
+    0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00,
+    0x01, 0x35, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x01, 0x11, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0xfe, 0xc0, 0x01,
+    0x40, 0x80, 0x80, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0,
+    0x01, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40,
+    0x01, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40,
+    0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xc0, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3b,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x01, 0x80, 0x01, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0,
+    0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x01, 0x11, 0x2b, 0x01,
+    0x19, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0xfe, 0xc0, 0x01, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0,
+    0xfe, 0x40, 0xfe, 0x40, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0x40, 0x01, 0xc0,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x02, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0xc0, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x03, 0x40,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x03, 0x40, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x29, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x40, 0xfe, 0x40,
+    0x02, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x01, 0x80, 0x01, 0x80, 0xfe, 0x40, 0xfe, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x80, 0xfe, 0x80,
+    0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17,
+    0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0,
+    0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x02, 0x40, 0x01, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x01, 0x40, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x11, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x01, 0xc0,
+    0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0,
+    0xc0, 0x40, 0x40, 0x80, 0x80, 0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0xfe,
+    0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x40,
+    0xc0, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x15, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80,
+    0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0xc0, 0x01, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0xc0,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b,
+    0x00, 0x00, 0x13, 0x11, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b,
+    0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02,
+    0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x37, 0x00, 0x00, 0x11, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40,
+    0xc0, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0xc0,
+    0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x01, 0xc0,
+    0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00,
+    0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0x01, 0xc0, 0x01, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x19, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x01, 0x80, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02,
+    0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x02, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x25, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0xc0, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0xfe, 0x40, 0xfe, 0x40, 0x01, 0xc0, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0xc0, 0x01, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x25, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x01, 0xc0, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xc0,
+    0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x03, 0x00, 0x00, 0x27,
+    0x00, 0x2f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0,
+    0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x01, 0x40, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x02, 0xc0, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b,
+    0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02,
+    0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40,
+    0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0xc0, 0xc0, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x80,
+    0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x40, 0x01, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01,
+    0x40, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0,
+    0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x13,
+    0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x80, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0,
+    0xc0, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00,
+    0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00,
+    0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x02, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x40, 0x01, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x3f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x01, 0xc0, 0x01, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x40, 0x40, 0xc0,
+    0xc0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x00, 0x01,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0xfe, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+    0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xc0, 0x01, 0xc0, 0x01, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xfe, 0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x11, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x02, 0x00, 0x02, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x02, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0xfe, 0x40,
+    0xfe, 0x40, 0x02, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x02, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x02, 0xc0, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x01, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x25, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0xfd, 0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x27,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b,
+    0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x01, 0x11,
+    0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0xc0, 0xc0, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x01, 0x80, 0x01, 0x80, 0xfe, 0xc0, 0x01, 0x40, 0xfe, 0xc0,
+    0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x00, 0x25, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x25, 0x11, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0xfd, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x03, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x40, 0x01, 0xc0, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80,
+    0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x02, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x13, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03,
+    0xc0, 0x40, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff,
+    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x29, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x02, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x03, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x11, 0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x03, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x29, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x02, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x3b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x01, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x40, 0xfe, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x03, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01, 0x40, 0x01, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01, 0x29, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80,
+    0xc0, 0xc0, 0x80, 0x80, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x01, 0x80, 0x01, 0x80,
+    0xfe, 0x80, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x3f,
+    0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x11, 0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x80, 0x80, 0x40, 0x40, 0x02, 0xc0, 0x01, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x25, 0x35, 0x2b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x19, 0x01, 0x3b, 0x01, 0x02, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x29, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x03, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc0,
+    0xfe, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x40,
+    0x01, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x2f, 0x00, 0x00, 0x25, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x2f, 0x00, 0x00,
+    0x25, 0x35, 0x29, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x11, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40,
+    0x40, 0x40, 0x03, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x19, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x02, 0x40, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x29, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x01, 0xc0, 0x01, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x03, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0xc0, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37,
+    0x00, 0x5f, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
+    0x3d, 0x01, 0x2b, 0x01, 0x01, 0x80, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x35,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1f,
+    0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01,
+    0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+    0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x37, 0x00, 0x00, 0x01, 0x11,
+    0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x80, 0x03, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x11, 0x29, 0x01, 0x19, 0x01, 0x29, 0x01, 0x01, 0x35,
+    0x29, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02,
+    0x80, 0xff, 0x00, 0xff, 0x00, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0xff, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x02, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0xfe, 0x40, 0x02, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00,
+    0x01, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0xfe, 0xc0, 0xfe, 0xc0, 0x80, 0x80, 0x01, 0x40, 0x40, 0x80,
+    0x80, 0x40, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x2f,
+    0x00, 0x37, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x1d, 0x01,
+    0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
+    0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x17, 0x35, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x05, 0x35,
+    0x2b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x02, 0x00,
+    0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x40, 0x40, 0x40, 0x40, 0x01, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x3b, 0x01, 0x1d, 0x01,
+    0x2b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01,
+    0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x01, 0x00,
+    0xc0, 0xc0, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x03, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0xc0, 0xfe, 0xc0, 0x01,
+    0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
+    0x01, 0x35, 0x29, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x19, 0x01, 0x2b, 0x01,
+    0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x05, 0x35, 0x2b, 0x01,
+    0x1d, 0x01, 0x3b, 0x01, 0x01, 0x00, 0x01, 0x40, 0x01, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xc0, 0x40, 0xfe,
+    0x40, 0xfe, 0x40, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xde, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x9e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0e, 0x01, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
+    0x01, 0x2a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x01, 0x88, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x01, 0xd1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0d, 0x01, 0xfc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c,
+    0x02, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 0x35, 0x24, 0x9d, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x36, 0x09, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1c,
+    0x00, 0xed, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x01, 0x1a, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x54, 0x01, 0x32, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x1c, 0x01, 0xb3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x1a,
+    0x01, 0xe0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x18, 0x02, 0x0a, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x22, 0x6a, 0x02, 0x31, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0e, 0x00, 0x34, 0x35, 0xd3, 0x00, 0x28, 0x00, 0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32,
+    0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x79,
+    0x00, 0x20, 0x00, 0x22, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x4d, 0x00, 0x61,
+    0x00, 0x6e, 0x00, 0x33, 0x00, 0x38, 0x00, 0x22, 0x00, 0x20, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x69,
+    0x00, 0x73, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x69, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x20,
+    0x00, 0x52, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
+    0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74,
+    0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f,
+    0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
+    0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
+    0x00, 0x2e, 0x00, 0x00, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x31, 0x20, 0x43, 0x6f, 0x64,
+    0x79, 0x20, 0x22, 0x43, 0x6f, 0x64, 0x65, 0x4d, 0x61, 0x6e, 0x33, 0x38, 0x22, 0x20, 0x42, 0x6f,
+    0x69, 0x73, 0x63, 0x6c, 0x61, 0x69, 0x72, 0x2e, 0x20, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+    0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x49, 0x4c, 0x20,
+    0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+    0x65, 0x2e, 0x00, 0x00, 0x50, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x50, 0x00,
+    0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x32, 0x50, 0x00,
+    0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x00,
+    0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
+    0x00, 0x46, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e,
+    0x00, 0x30, 0x00, 0x20, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73,
+    0x00, 0x73, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20,
+    0x00, 0x32, 0x00, 0x50, 0x00, 0x20, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x31, 0x00, 0x32, 0x00, 0x2d,
+    0x00, 0x36, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x00, 0x46, 0x6f,
+    0x6e, 0x74, 0x46, 0x6f, 0x72, 0x67, 0x65, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x3a, 0x20, 0x50, 0x72,
+    0x65, 0x73, 0x73, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x32, 0x50, 0x20, 0x3a, 0x20, 0x31,
+    0x32, 0x2d, 0x36, 0x2d, 0x32, 0x30, 0x31, 0x31, 0x00, 0x00, 0x50, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x73, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x32, 0x00, 0x50, 0x00, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x53, 0x74, 0x61,
+    0x72, 0x74, 0x20, 0x32, 0x50, 0x00, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
+    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x34, 0x00, 0x20,
+    0x00, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x31, 0x34, 0x20, 0x00,
+    0x00, 0x50, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61,
+    0x00, 0x72, 0x00, 0x74, 0x00, 0x32, 0x00, 0x50, 0x00, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x53,
+    0x74, 0x61, 0x72, 0x74, 0x32, 0x50, 0x00, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+    0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00,
+    0x29, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x79, 0x00, 0x20, 0x00, 0x22, 0x00, 0x43, 0x00, 0x6f, 0x00,
+    0x64, 0x00, 0x65, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x33, 0x00, 0x38, 0x00, 0x22, 0x00,
+    0x20, 0x00, 0x42, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x61, 0x00,
+    0x69, 0x00, 0x72, 0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x79, 0x00,
+    0x40, 0x00, 0x7a, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x33, 0x00, 0x38, 0x00, 0x2e, 0x00,
+    0x6e, 0x00, 0x65, 0x00, 0x74, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x0a, 0x00, 0x77, 0x00, 0x69, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x74, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00,
+    0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00,
+    0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x2e, 0x00,
+    0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00,
+    0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+    0x62, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6c, 0x00,
+    0x73, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6c, 0x00,
+    0x61, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
+    0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
+    0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+    0x0a, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x0a, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00,
+    0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x43, 0x00, 0x45, 0x00, 0x4e, 0x00,
+    0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x20, 0x00, 0x2d, 0x00,
+    0x20, 0x00, 0x32, 0x00, 0x36, 0x00, 0x20, 0x00, 0x46, 0x00, 0x65, 0x00, 0x62, 0x00, 0x72, 0x00,
+    0x75, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x37, 0x00, 0x0a, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+    0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x50, 0x00,
+    0x52, 0x00, 0x45, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x45, 0x00, 0x0a, 0x00,
+    0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x61, 0x00, 0x6c, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00,
+    0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x28, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x29, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00,
+    0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x77, 0x00,
+    0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+    0x6c, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x61, 0x00,
+    0x62, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00,
+    0x6f, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x0a, 0x00, 0x65, 0x00, 0x66, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x63, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x63, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x6e, 0x00,
+    0x67, 0x00, 0x75, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00,
+    0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x69, 0x00, 0x74, 0x00,
+    0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00,
+    0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x6f, 0x00,
+    0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6d, 0x00,
+    0x65, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x69, 0x00, 0x63, 0x00, 0x68, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00,
+    0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00,
+    0x6d, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x6e, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x68, 0x00, 0x69, 0x00, 0x70, 0x00, 0x0a, 0x00, 0x77, 0x00,
+    0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+    0x6f, 0x00, 0x77, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x64, 0x00, 0x69, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00,
+    0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00,
+    0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x65, 0x00, 0x6d, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x65, 0x00, 0x73, 0x00,
+    0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x66, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x63, 0x00,
+    0x6c, 0x00, 0x75, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00,
+    0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x6c, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x62, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x0a, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x64, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00,
+    0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00,
+    0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x6e, 0x00,
+    0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x77, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x73, 0x00,
+    0x2c, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x6f, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6c, 0x00,
+    0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00,
+    0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x79, 0x00,
+    0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00,
+    0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x71, 0x00, 0x75, 0x00, 0x69, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00,
+    0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00,
+    0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x75, 0x00,
+    0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x69, 0x00,
+    0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x69, 0x00, 0x72, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x49, 0x00,
+    0x4e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x0a, 0x00,
+    0x22, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x22, 0x00, 0x20, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6c, 0x00,
+    0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x61, 0x00,
+    0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x0a, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+    0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x75, 0x00,
+    0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6c, 0x00,
+    0x65, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00,
+    0x72, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x73, 0x00, 0x75, 0x00, 0x63, 0x00, 0x68, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00,
+    0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x69, 0x00,
+    0x6e, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00,
+    0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00,
+    0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x69, 0x00,
+    0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
+    0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00,
+    0x6f, 0x00, 0x63, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00,
+    0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x61, 0x00,
+    0x6d, 0x00, 0x65, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x73, 0x00, 0x70, 0x00, 0x65, 0x00, 0x63, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x63, 0x00,
+    0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x66, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+    0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00,
+    0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x28, 0x00,
+    0x73, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x4f, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x56, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x22, 0x00, 0x20, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00,
+    0x6c, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x0a, 0x00,
+    0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00,
+    0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+    0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x0a, 0x00,
+    0x0a, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x64, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x64, 0x00, 0x64, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x64, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00,
+    0x2c, 0x00, 0x0a, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x62, 0x00,
+    0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x74, 0x00, 0x75, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00,
+    0x67, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00,
+    0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00,
+    0x6f, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x0a, 0x00, 0x4f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00,
+    0x6c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00,
+    0x61, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x72, 0x00,
+    0x74, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x0a, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x77, 0x00, 0x20, 0x00,
+    0x65, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x69, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6d, 0x00,
+    0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x41, 0x00,
+    0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00,
+    0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x65, 0x00,
+    0x6e, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6d, 0x00,
+    0x6d, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x74, 0x00, 0x65, 0x00, 0x63, 0x00,
+    0x68, 0x00, 0x6e, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x0a, 0x00, 0x77, 0x00,
+    0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x70, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x50, 0x00, 0x45, 0x00, 0x52, 0x00,
+    0x4d, 0x00, 0x49, 0x00, 0x53, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x20, 0x00,
+    0x26, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x49, 0x00, 0x54, 0x00,
+    0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x0a, 0x00, 0x50, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
+    0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x65, 0x00, 0x62, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x67, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72, 0x00, 0x67, 0x00,
+    0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x74, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x69, 0x00,
+    0x6e, 0x00, 0x67, 0x00, 0x0a, 0x00, 0x61, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x64, 0x00, 0x79, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x63, 0x00,
+    0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x67, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x62, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00,
+    0x79, 0x00, 0x2c, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00,
+    0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6c, 0x00,
+    0x6c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00,
+    0x6e, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x0a, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00,
+    0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x73, 0x00,
+    0x75, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00,
+    0x6c, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00,
+    0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x31, 0x00, 0x29, 0x00, 0x20, 0x00,
+    0x4e, 0x00, 0x65, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00,
+    0x75, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x70, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x0a, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00,
+    0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x4d, 0x00,
+    0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x2c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00,
+    0x20, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x66, 0x00, 0x2e, 0x00,
+    0x0a, 0x00, 0x0a, 0x00, 0x32, 0x00, 0x29, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+    0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00,
+    0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x6d, 0x00, 0x61, 0x00, 0x79, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x62, 0x00,
+    0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2c, 0x00, 0x0a, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x64, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00,
+    0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00,
+    0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x61, 0x00, 0x74, 0x00, 0x20, 0x00, 0x65, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x20, 0x00,
+    0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x74, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x0a, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x65, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x2d, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x68, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x2d, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6c, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x68, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x72, 0x00,
+    0x6f, 0x00, 0x70, 0x00, 0x72, 0x00, 0x69, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x6d, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x2d, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x74, 0x00, 0x61, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00,
+    0x61, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x0a, 0x00,
+    0x62, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00,
+    0x65, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x73, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x69, 0x00,
+    0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00, 0x77, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+    0x33, 0x00, 0x29, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
+    0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00,
+    0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00, 0x20, 0x00,
+    0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x0a, 0x00, 0x4e, 0x00, 0x61, 0x00,
+    0x6d, 0x00, 0x65, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00,
+    0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x20, 0x00, 0x65, 0x00, 0x78, 0x00, 0x70, 0x00,
+    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x69, 0x00, 0x74, 0x00, 0x20, 0x00, 0x77, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+    0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x67, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00,
+    0x0a, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00,
+    0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x63, 0x00, 0x74, 0x00,
+    0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6c, 0x00, 0x79, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x70, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79, 0x00, 0x20, 0x00,
+    0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x70, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x73, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x34, 0x00, 0x29, 0x00,
+    0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+    0x65, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+    0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00,
+    0x6c, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00,
+    0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x0a, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00,
+    0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x68, 0x00,
+    0x61, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00,
+    0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6f, 0x00,
+    0x74, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x64, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x69, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00,
+    0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x65, 0x00,
+    0x78, 0x00, 0x63, 0x00, 0x65, 0x00, 0x70, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x6c, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x67, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00,
+    0x75, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x0a, 0x00,
+    0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+    0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x65, 0x00, 0x69, 0x00, 0x72, 0x00, 0x20, 0x00, 0x65, 0x00, 0x78, 0x00, 0x70, 0x00, 0x6c, 0x00,
+    0x69, 0x00, 0x63, 0x00, 0x69, 0x00, 0x74, 0x00, 0x20, 0x00, 0x77, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x0a, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00,
+    0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2e, 0x00,
+    0x0a, 0x00, 0x0a, 0x00, 0x35, 0x00, 0x29, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+    0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x6d, 0x00, 0x6f, 0x00,
+    0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00,
+    0x6f, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x73, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00,
+    0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x20, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6c, 0x00,
+    0x79, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00,
+    0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6e, 0x00,
+    0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00,
+    0x65, 0x00, 0x71, 0x00, 0x75, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x66, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x0a, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00,
+    0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00,
+    0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x79, 0x00,
+    0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00,
+    0x64, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00,
+    0x0a, 0x00, 0x75, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+    0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x45, 0x00, 0x52, 0x00, 0x4d, 0x00, 0x49, 0x00,
+    0x4e, 0x00, 0x41, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x0a, 0x00, 0x54, 0x00,
+    0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00,
+    0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x63, 0x00, 0x6f, 0x00,
+    0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x76, 0x00, 0x6f, 0x00, 0x69, 0x00,
+    0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x66, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00,
+    0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x61, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00,
+    0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x44, 0x00,
+    0x49, 0x00, 0x53, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x41, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x45, 0x00,
+    0x52, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00,
+    0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x54, 0x00, 0x57, 0x00,
+    0x41, 0x00, 0x52, 0x00, 0x45, 0x00, 0x20, 0x00, 0x49, 0x00, 0x53, 0x00, 0x20, 0x00, 0x50, 0x00,
+    0x52, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x49, 0x00, 0x44, 0x00, 0x45, 0x00, 0x44, 0x00, 0x20, 0x00,
+    0x22, 0x00, 0x41, 0x00, 0x53, 0x00, 0x20, 0x00, 0x49, 0x00, 0x53, 0x00, 0x22, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x57, 0x00, 0x49, 0x00, 0x54, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x55, 0x00, 0x54, 0x00,
+    0x20, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x52, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x54, 0x00,
+    0x59, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x59, 0x00,
+    0x20, 0x00, 0x4b, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x2c, 0x00, 0x0a, 0x00, 0x45, 0x00,
+    0x58, 0x00, 0x50, 0x00, 0x52, 0x00, 0x45, 0x00, 0x53, 0x00, 0x53, 0x00, 0x20, 0x00, 0x4f, 0x00,
+    0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x45, 0x00,
+    0x44, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00,
+    0x44, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x20, 0x00, 0x42, 0x00, 0x55, 0x00, 0x54, 0x00,
+    0x20, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x4d, 0x00,
+    0x49, 0x00, 0x54, 0x00, 0x45, 0x00, 0x44, 0x00, 0x20, 0x00, 0x54, 0x00, 0x4f, 0x00, 0x20, 0x00,
+    0x41, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x52, 0x00,
+    0x41, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x49, 0x00, 0x45, 0x00, 0x53, 0x00, 0x20, 0x00, 0x4f, 0x00,
+    0x46, 0x00, 0x0a, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x52, 0x00, 0x43, 0x00, 0x48, 0x00, 0x41, 0x00,
+    0x4e, 0x00, 0x54, 0x00, 0x41, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x54, 0x00,
+    0x59, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x46, 0x00, 0x49, 0x00, 0x54, 0x00, 0x4e, 0x00, 0x45, 0x00,
+    0x53, 0x00, 0x53, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x41, 0x00,
+    0x20, 0x00, 0x50, 0x00, 0x41, 0x00, 0x52, 0x00, 0x54, 0x00, 0x49, 0x00, 0x43, 0x00, 0x55, 0x00,
+    0x4c, 0x00, 0x41, 0x00, 0x52, 0x00, 0x20, 0x00, 0x50, 0x00, 0x55, 0x00, 0x52, 0x00, 0x50, 0x00,
+    0x4f, 0x00, 0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x20, 0x00,
+    0x4e, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x46, 0x00, 0x52, 0x00, 0x49, 0x00,
+    0x4e, 0x00, 0x47, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x0a, 0x00,
+    0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x59, 0x00, 0x52, 0x00,
+    0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x50, 0x00, 0x41, 0x00,
+    0x54, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x54, 0x00, 0x52, 0x00,
+    0x41, 0x00, 0x44, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x41, 0x00, 0x52, 0x00, 0x4b, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00,
+    0x52, 0x00, 0x20, 0x00, 0x52, 0x00, 0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00, 0x2e, 0x00,
+    0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x45, 0x00,
+    0x56, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00, 0x48, 0x00, 0x41, 0x00,
+    0x4c, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x0a, 0x00, 0x43, 0x00,
+    0x4f, 0x00, 0x50, 0x00, 0x59, 0x00, 0x52, 0x00, 0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00,
+    0x20, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x4c, 0x00, 0x44, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00,
+    0x42, 0x00, 0x45, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x41, 0x00, 0x42, 0x00, 0x4c, 0x00,
+    0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00,
+    0x59, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x41, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x44, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x41, 0x00, 0x47, 0x00, 0x45, 0x00, 0x53, 0x00,
+    0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00,
+    0x52, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x41, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4c, 0x00,
+    0x49, 0x00, 0x54, 0x00, 0x59, 0x00, 0x2c, 0x00, 0x0a, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x43, 0x00,
+    0x4c, 0x00, 0x55, 0x00, 0x44, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x20, 0x00, 0x41, 0x00,
+    0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x47, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x45, 0x00, 0x52, 0x00,
+    0x41, 0x00, 0x4c, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x53, 0x00, 0x50, 0x00, 0x45, 0x00, 0x43, 0x00,
+    0x49, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00,
+    0x49, 0x00, 0x52, 0x00, 0x45, 0x00, 0x43, 0x00, 0x54, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x49, 0x00,
+    0x4e, 0x00, 0x43, 0x00, 0x49, 0x00, 0x44, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x41, 0x00,
+    0x4c, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00,
+    0x4e, 0x00, 0x53, 0x00, 0x45, 0x00, 0x51, 0x00, 0x55, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00,
+    0x49, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x41, 0x00,
+    0x47, 0x00, 0x45, 0x00, 0x53, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x57, 0x00, 0x48, 0x00, 0x45, 0x00,
+    0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x20, 0x00,
+    0x41, 0x00, 0x4e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x43, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00,
+    0x4e, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x4e, 0x00,
+    0x54, 0x00, 0x52, 0x00, 0x41, 0x00, 0x43, 0x00, 0x54, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x54, 0x00,
+    0x4f, 0x00, 0x52, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x4f, 0x00,
+    0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x52, 0x00, 0x57, 0x00, 0x49, 0x00, 0x53, 0x00, 0x45, 0x00,
+    0x2c, 0x00, 0x20, 0x00, 0x41, 0x00, 0x52, 0x00, 0x49, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4e, 0x00,
+    0x47, 0x00, 0x0a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x4f, 0x00, 0x55, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x54, 0x00,
+    0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x4f, 0x00,
+    0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x41, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4c, 0x00,
+    0x49, 0x00, 0x54, 0x00, 0x59, 0x00, 0x20, 0x00, 0x54, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x55, 0x00,
+    0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x46, 0x00,
+    0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x54, 0x00,
+    0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x45, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00,
+    0x46, 0x00, 0x52, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x48, 0x00,
+    0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x44, 0x00, 0x45, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x49, 0x00,
+    0x4e, 0x00, 0x47, 0x00, 0x53, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x20, 0x00, 0x54, 0x00,
+    0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00,
+    0x53, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x54, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x45, 0x00,
+    0x2e, 0x00, 0x00, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29,
+    0x20, 0x32, 0x30, 0x31, 0x31, 0x2c, 0x20, 0x43, 0x6f, 0x64, 0x79, 0x20, 0x22, 0x43, 0x6f, 0x64,
+    0x65, 0x4d, 0x61, 0x6e, 0x33, 0x38, 0x22, 0x20, 0x42, 0x6f, 0x69, 0x73, 0x63, 0x6c, 0x61, 0x69,
+    0x72, 0x20, 0x28, 0x63, 0x6f, 0x64, 0x79, 0x40, 0x7a, 0x6f, 0x6e, 0x65, 0x33, 0x38, 0x2e, 0x6e,
+    0x65, 0x74, 0x29, 0x2c, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76,
+    0x65, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x72, 0x65,
+    0x73, 0x73, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e,
+    0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69,
+    0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x2e, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63,
+    0x65, 0x6e, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x64, 0x20, 0x62,
+    0x65, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73,
+    0x6f, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x61, 0x20, 0x46, 0x41, 0x51, 0x20, 0x61, 0x74, 0x3a, 0x0a, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72,
+    0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x0a, 0x0a, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x0a, 0x53, 0x49, 0x4c, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x20, 0x46, 0x4f, 0x4e,
+    0x54, 0x20, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 0x45, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+    0x6e, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x2d, 0x20, 0x32, 0x36, 0x20, 0x46, 0x65, 0x62, 0x72, 0x75,
+    0x61, 0x72, 0x79, 0x20, 0x32, 0x30, 0x30, 0x37, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x50, 0x52, 0x45, 0x41, 0x4d, 0x42, 0x4c, 0x45, 0x0a, 0x54,
+    0x68, 0x65, 0x20, 0x67, 0x6f, 0x61, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+    0x65, 0x20, 0x28, 0x4f, 0x46, 0x4c, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73,
+    0x74, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x77, 0x69,
+    0x64, 0x65, 0x0a, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f,
+    0x66, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x2c, 0x20, 0x74,
+    0x6f, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x65, 0x66, 0x66, 0x6f,
+    0x72, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x63, 0x61, 0x64, 0x65, 0x6d, 0x69, 0x63, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x74, 0x69, 0x63, 0x20, 0x63,
+    0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+    0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x66, 0x72, 0x65,
+    0x65, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65,
+    0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65,
+    0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x69,
+    0x6e, 0x20, 0x70, 0x61, 0x72, 0x74, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x0a, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20,
+    0x4f, 0x46, 0x4c, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+    0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f,
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x73, 0x74, 0x75, 0x64, 0x69, 0x65,
+    0x64, 0x2c, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x0a,
+    0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x65, 0x65, 0x6c, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x61, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x6f, 0x6c,
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x73, 0x65, 0x6c, 0x76, 0x65, 0x73, 0x2e,
+    0x20, 0x54, 0x68, 0x65, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c,
+    0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20,
+    0x62, 0x65, 0x20, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x65, 0x6d, 0x62, 0x65,
+    0x64, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x0a, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
+    0x75, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x64,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x61, 0x6e, 0x79, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x0a, 0x6e, 0x61,
+    0x6d, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64,
+    0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77,
+    0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x73, 0x2c,
+    0x0a, 0x68, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74,
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64,
+    0x65, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x20, 0x54, 0x68,
+    0x65, 0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f,
+    0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69,
+    0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63,
+    0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x70,
+    0x70, 0x6c, 0x79, 0x0a, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x75, 0x73, 0x69, 0x6e,
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x69, 0x72, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x73,
+    0x2e, 0x0a, 0x0a, 0x44, 0x45, 0x46, 0x49, 0x4e, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x0a, 0x22,
+    0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x20, 0x72,
+    0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74,
+    0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x0a, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73, 0x29, 0x20, 0x75, 0x6e,
+    0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x72,
+    0x6b, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x69,
+    0x73, 0x20, 0x6d, 0x61, 0x79, 0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x73, 0x6f,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x62, 0x75, 0x69, 0x6c,
+    0x64, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x22, 0x52,
+    0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d,
+    0x65, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79,
+    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64,
+    0x20, 0x61, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x0a, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 0x22, 0x4f, 0x72, 0x69,
+    0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x72,
+    0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6c,
+    0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20,
+    0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65,
+    0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x0a, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73, 0x29, 0x2e, 0x0a, 0x0a,
+    0x22, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+    0x6e, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79,
+    0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6d, 0x61, 0x64, 0x65,
+    0x20, 0x62, 0x79, 0x20, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x2c, 0x20, 0x64,
+    0x65, 0x6c, 0x65, 0x74, 0x69, 0x6e, 0x67, 0x2c, 0x0a, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x2d, 0x2d, 0x20, 0x69, 0x6e, 0x20, 0x70,
+    0x61, 0x72, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20,
+    0x2d, 0x2d, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
+    0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a,
+    0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+    0x2c, 0x20, 0x62, 0x79, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f,
+    0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20, 0x70, 0x6f, 0x72, 0x74,
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x0a, 0x6e, 0x65, 0x77, 0x20, 0x65,
+    0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x22, 0x41, 0x75,
+    0x74, 0x68, 0x6f, 0x72, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20,
+    0x61, 0x6e, 0x79, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x2c, 0x20, 0x65, 0x6e,
+    0x67, 0x69, 0x6e, 0x65, 0x65, 0x72, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d,
+    0x65, 0x72, 0x2c, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x0a, 0x77, 0x72,
+    0x69, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x65,
+    0x72, 0x73, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62,
+    0x75, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74,
+    0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x45, 0x52, 0x4d,
+    0x49, 0x53, 0x53, 0x49, 0x4f, 0x4e, 0x20, 0x26, 0x20, 0x43, 0x4f, 0x4e, 0x44, 0x49, 0x54, 0x49,
+    0x4f, 0x4e, 0x53, 0x0a, 0x50, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69,
+    0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64,
+    0x2c, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65,
+    0x2c, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x20,
+    0x6f, 0x62, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x0a, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79,
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x73,
+    0x74, 0x75, 0x64, 0x79, 0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x2c, 0x20, 0x6d, 0x65, 0x72, 0x67,
+    0x65, 0x2c, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x2c, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79,
+    0x2c, 0x0a, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x2c, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x6c, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
+    0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46,
+    0x6f, 0x6e, 0x74, 0x0a, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x75,
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c,
+    0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+    0x73, 0x3a, 0x0a, 0x0a, 0x31, 0x29, 0x20, 0x4e, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+    0x20, 0x6e, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20,
+    0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f,
+    0x6e, 0x65, 0x6e, 0x74, 0x73, 0x2c, 0x0a, 0x69, 0x6e, 0x20, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e,
+    0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56,
+    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20,
+    0x73, 0x6f, 0x6c, 0x64, 0x20, 0x62, 0x79, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x0a,
+    0x0a, 0x32, 0x29, 0x20, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20,
+    0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f,
+    0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75,
+    0x6e, 0x64, 0x6c, 0x65, 0x64, 0x2c, 0x0a, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
+    0x75, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x64,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x0a, 0x63, 0x6f, 0x6e, 0x74,
+    0x61, 0x69, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x63,
+    0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x0a, 0x69,
+    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61,
+    0x73, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x2d, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x68, 0x75, 0x6d, 0x61, 0x6e, 0x2d,
+    0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+    0x20, 0x6f, 0x72, 0x0a, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f,
+    0x70, 0x72, 0x69, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x63, 0x68, 0x69, 0x6e, 0x65, 0x2d, 0x72,
+    0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x20, 0x6f, 0x72, 0x0a, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x66, 0x69,
+    0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x61, 0x73, 0x20, 0x74,
+    0x68, 0x6f, 0x73, 0x65, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20,
+    0x62, 0x65, 0x20, 0x65, 0x61, 0x73, 0x69, 0x6c, 0x79, 0x20, 0x76, 0x69, 0x65, 0x77, 0x65, 0x64,
+    0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x33,
+    0x29, 0x20, 0x4e, 0x6f, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e,
+    0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x75,
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20,
+    0x46, 0x6f, 0x6e, 0x74, 0x0a, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x73, 0x29, 0x20, 0x75, 0x6e, 0x6c,
+    0x65, 0x73, 0x73, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x20, 0x77, 0x72, 0x69,
+    0x74, 0x74, 0x65, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+    0x69, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x0a,
+    0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72,
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20,
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x20, 0x66,
+    0x6f, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x0a, 0x70, 0x72, 0x65, 0x73,
+    0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x72, 0x73, 0x2e, 0x0a, 0x0a, 0x34, 0x29, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x28, 0x73, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72,
+    0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73, 0x29, 0x20, 0x6f,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x28, 0x73, 0x29, 0x20,
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x0a, 0x53, 0x6f, 0x66, 0x74,
+    0x77, 0x61, 0x72, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62,
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74,
+    0x65, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x64,
+    0x76, 0x65, 0x72, 0x74, 0x69, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x4d, 0x6f, 0x64, 0x69,
+    0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x65, 0x78,
+    0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x63, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65,
+    0x64, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x43,
+    0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28,
+    0x73, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6f,
+    0x72, 0x28, 0x73, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x69, 0x72, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74,
+    0x74, 0x65, 0x6e, 0x0a, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a,
+    0x0a, 0x35, 0x29, 0x20, 0x54, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x2c, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+    0x6f, 0x72, 0x20, 0x75, 0x6e, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2c, 0x20, 0x69,
+    0x6e, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x6f,
+    0x6c, 0x65, 0x2c, 0x0a, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74,
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x6c, 0x79,
+    0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65,
+    0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x6e, 0x6f,
+    0x74, 0x20, 0x62, 0x65, 0x0a, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64,
+    0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+    0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x0a, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x75, 0x6e,
+    0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20,
+    0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e,
+    0x0a, 0x0a, 0x54, 0x45, 0x52, 0x4d, 0x49, 0x4e, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x0a, 0x54, 0x68,
+    0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d,
+    0x65, 0x73, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x6f, 0x69, 0x64,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x62, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x0a, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x2e, 0x0a, 0x0a, 0x44, 0x49,
+    0x53, 0x43, 0x4c, 0x41, 0x49, 0x4d, 0x45, 0x52, 0x0a, 0x54, 0x48, 0x45, 0x20, 0x46, 0x4f, 0x4e,
+    0x54, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x49, 0x53, 0x20, 0x50, 0x52,
+    0x4f, 0x56, 0x49, 0x44, 0x45, 0x44, 0x20, 0x22, 0x41, 0x53, 0x20, 0x49, 0x53, 0x22, 0x2c, 0x20,
+    0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x59,
+    0x20, 0x4f, 0x46, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x4b, 0x49, 0x4e, 0x44, 0x2c, 0x0a, 0x45, 0x58,
+    0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x4f, 0x52, 0x20, 0x49, 0x4d, 0x50, 0x4c, 0x49, 0x45, 0x44,
+    0x2c, 0x20, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20, 0x42, 0x55, 0x54, 0x20,
+    0x4e, 0x4f, 0x54, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x45, 0x44, 0x20, 0x54, 0x4f, 0x20, 0x41,
+    0x4e, 0x59, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4f, 0x46,
+    0x0a, 0x4d, 0x45, 0x52, 0x43, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59,
+    0x2c, 0x20, 0x46, 0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x20,
+    0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x55, 0x4c, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f,
+    0x53, 0x45, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x4e, 0x4f, 0x4e, 0x49, 0x4e, 0x46, 0x52, 0x49, 0x4e,
+    0x47, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x0a, 0x4f, 0x46, 0x20, 0x43, 0x4f, 0x50, 0x59, 0x52, 0x49,
+    0x47, 0x48, 0x54, 0x2c, 0x20, 0x50, 0x41, 0x54, 0x45, 0x4e, 0x54, 0x2c, 0x20, 0x54, 0x52, 0x41,
+    0x44, 0x45, 0x4d, 0x41, 0x52, 0x4b, 0x2c, 0x20, 0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52,
+    0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x2e, 0x20, 0x49, 0x4e, 0x20, 0x4e, 0x4f, 0x20, 0x45, 0x56,
+    0x45, 0x4e, 0x54, 0x20, 0x53, 0x48, 0x41, 0x4c, 0x4c, 0x20, 0x54, 0x48, 0x45, 0x0a, 0x43, 0x4f,
+    0x50, 0x59, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x48, 0x4f, 0x4c, 0x44, 0x45, 0x52, 0x20, 0x42,
+    0x45, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x4e, 0x59,
+    0x20, 0x43, 0x4c, 0x41, 0x49, 0x4d, 0x2c, 0x20, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x53, 0x20,
+    0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x49, 0x4c, 0x49,
+    0x54, 0x59, 0x2c, 0x0a, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20, 0x41, 0x4e,
+    0x59, 0x20, 0x47, 0x45, 0x4e, 0x45, 0x52, 0x41, 0x4c, 0x2c, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49,
+    0x41, 0x4c, 0x2c, 0x20, 0x49, 0x4e, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x2c, 0x20, 0x49, 0x4e,
+    0x43, 0x49, 0x44, 0x45, 0x4e, 0x54, 0x41, 0x4c, 0x2c, 0x20, 0x4f, 0x52, 0x20, 0x43, 0x4f, 0x4e,
+    0x53, 0x45, 0x51, 0x55, 0x45, 0x4e, 0x54, 0x49, 0x41, 0x4c, 0x0a, 0x44, 0x41, 0x4d, 0x41, 0x47,
+    0x45, 0x53, 0x2c, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x20, 0x41,
+    0x4e, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x4f, 0x46, 0x20, 0x43, 0x4f, 0x4e, 0x54,
+    0x52, 0x41, 0x43, 0x54, 0x2c, 0x20, 0x54, 0x4f, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x4f, 0x54,
+    0x48, 0x45, 0x52, 0x57, 0x49, 0x53, 0x45, 0x2c, 0x20, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4e, 0x47,
+    0x0a, 0x46, 0x52, 0x4f, 0x4d, 0x2c, 0x20, 0x4f, 0x55, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x54, 0x48,
+    0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x49, 0x4e, 0x41, 0x42, 0x49, 0x4c, 0x49,
+    0x54, 0x59, 0x20, 0x54, 0x4f, 0x20, 0x55, 0x53, 0x45, 0x20, 0x54, 0x48, 0x45, 0x20, 0x46, 0x4f,
+    0x4e, 0x54, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x46,
+    0x52, 0x4f, 0x4d, 0x0a, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x20, 0x44, 0x45, 0x41, 0x4c, 0x49, 0x4e,
+    0x47, 0x53, 0x20, 0x49, 0x4e, 0x20, 0x54, 0x48, 0x45, 0x20, 0x46, 0x4f, 0x4e, 0x54, 0x20, 0x53,
+    0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2e, 0x00, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00,
+    0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00,
+    0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69,
+    0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08,
+    0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
+    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
+    0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20,
+    0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
+    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
+    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
+    0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40,
+    0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
+    0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50,
+    0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
+    0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60,
+    0x00, 0x61, 0x01, 0x02, 0x01, 0x03, 0x00, 0xa3, 0x00, 0x84, 0x00, 0x85, 0x00, 0xbd, 0x00, 0x96,
+    0x00, 0xe8, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xa4, 0x01, 0x04,
+    0x00, 0x8a, 0x00, 0xda, 0x00, 0x83, 0x00, 0x93, 0x01, 0x05, 0x01, 0x06, 0x00, 0x8d, 0x01, 0x07,
+    0x00, 0x88, 0x00, 0xc3, 0x00, 0xde, 0x01, 0x08, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0xf4,
+    0x00, 0xf6, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae, 0x00, 0x62, 0x00, 0x63,
+    0x00, 0x90, 0x00, 0x64, 0x00, 0xcb, 0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf, 0x00, 0xcc,
+    0x00, 0xcd, 0x00, 0xce, 0x00, 0xe9, 0x00, 0x66, 0x00, 0xd3, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0xaf,
+    0x00, 0x67, 0x00, 0xf0, 0x00, 0x91, 0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x68, 0x00, 0xeb,
+    0x00, 0xed, 0x00, 0x89, 0x00, 0x6a, 0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6c, 0x00, 0x6e,
+    0x00, 0xa0, 0x00, 0x6f, 0x00, 0x71, 0x00, 0x70, 0x00, 0x72, 0x00, 0x73, 0x00, 0x75, 0x00, 0x74,
+    0x00, 0x76, 0x00, 0x77, 0x00, 0xea, 0x00, 0x78, 0x00, 0x7a, 0x00, 0x79, 0x00, 0x7b, 0x00, 0x7d,
+    0x00, 0x7c, 0x00, 0xb8, 0x00, 0xa1, 0x00, 0x7f, 0x00, 0x7e, 0x00, 0x80, 0x00, 0x81, 0x00, 0xec,
+    0x00, 0xee, 0x00, 0xba, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
+    0x00, 0xfd, 0x00, 0xfe, 0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x00, 0xff, 0x01, 0x00,
+    0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x01, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19,
+    0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21,
+    0x00, 0xf8, 0x00, 0xf9, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27,
+    0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f,
+    0x01, 0x30, 0x01, 0x31, 0x00, 0xfa, 0x00, 0xd7, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35,
+    0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d,
+    0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x00, 0xe2, 0x00, 0xe3, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43,
+    0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b,
+    0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x00, 0xb0, 0x00, 0xb1, 0x01, 0x50, 0x01, 0x51,
+    0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59,
+    0x00, 0xfb, 0x00, 0xfc, 0x00, 0xe4, 0x00, 0xe5, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d,
+    0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65,
+    0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d,
+    0x01, 0x6e, 0x01, 0x6f, 0x00, 0xbb, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x00, 0xe6,
+    0x00, 0xe7, 0x01, 0x74, 0x00, 0xa6, 0x00, 0xd8, 0x00, 0xe1, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
+    0x01, 0x78, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xe0, 0x00, 0xd9, 0x00, 0xdf, 0x01, 0x79,
+    0x01, 0x7a, 0x01, 0x7b, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x01, 0x81,
+    0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x00, 0xa8,
+    0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90,
+    0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98,
+    0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x00, 0x9f, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f,
+    0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7,
+    0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad, 0x00, 0x97, 0x01, 0xae,
+    0x01, 0xaf, 0x01, 0xb0, 0x00, 0x9b, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5,
+    0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd,
+    0x01, 0xbe, 0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc5,
+    0x01, 0xc6, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcd,
+    0x01, 0xce, 0x01, 0xcf, 0x01, 0xd0, 0x01, 0xd1, 0x01, 0xd2, 0x01, 0xd3, 0x01, 0xd4, 0x01, 0xd5,
+    0x01, 0xd6, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9, 0x01, 0xda, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xdd,
+    0x01, 0xde, 0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5,
+    0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xe9, 0x01, 0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed,
+    0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01, 0xf2, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf5,
+    0x01, 0xf6, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfd,
+    0x01, 0xfe, 0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05,
+    0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d,
+    0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15,
+    0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d,
+    0x02, 0x1e, 0x00, 0xb2, 0x00, 0xb3, 0x02, 0x1f, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xb4,
+    0x00, 0xb5, 0x00, 0xc5, 0x00, 0x82, 0x00, 0xc2, 0x00, 0x87, 0x00, 0xab, 0x00, 0xc6, 0x00, 0xbe,
+    0x00, 0xbf, 0x00, 0xbc, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x00, 0x8c, 0x02, 0x23, 0x02, 0x24,
+    0x02, 0x25, 0x02, 0x26, 0x00, 0x98, 0x02, 0x27, 0x00, 0x9a, 0x00, 0x99, 0x00, 0xa5, 0x00, 0x92,
+    0x00, 0x9c, 0x00, 0xa7, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x95, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a,
+    0x02, 0x2b, 0x00, 0xb9, 0x02, 0x2c, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x30, 0x02, 0x31,
+    0x02, 0x32, 0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x30, 0x37, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41, 0x30, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x30, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x35, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x30, 0x42, 0x39, 0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6d, 0x61,
+    0x63, 0x72, 0x6f, 0x6e, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61, 0x62, 0x72, 0x65,
+    0x76, 0x65, 0x07, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e,
+    0x65, 0x6b, 0x0b, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x63,
+    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f, 0x74, 0x61,
+    0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+    0x06, 0x44, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x44,
+    0x63, 0x72, 0x6f, 0x61, 0x74, 0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6d,
+    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x0a, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x65,
+    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
+    0x6b, 0x07, 0x65, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e,
+    0x06, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+    0x6c, 0x65, 0x78, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a,
+    0x47, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64, 0x6f, 0x74, 0x61,
+    0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65,
+    0x6e, 0x74, 0x0c, 0x67, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b,
+    0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x68, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x04, 0x48, 0x62, 0x61, 0x72, 0x04, 0x68, 0x62, 0x61,
+    0x72, 0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07,
+    0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06,
+    0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x49, 0x6f,
+    0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x02, 0x49, 0x4a,
+    0x02, 0x69, 0x6a, 0x0b, 0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b,
+    0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x4b, 0x63, 0x6f, 0x6d,
+    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61,
+    0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64,
+    0x69, 0x63, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0c, 0x4c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6c, 0x63,
+    0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f,
+    0x6e, 0x06, 0x6c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x04, 0x6c, 0x64,
+    0x6f, 0x74, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0c, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6e, 0x63,
+    0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4e, 0x63, 0x61, 0x72, 0x6f,
+    0x6e, 0x06, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73, 0x74, 0x72,
+    0x6f, 0x70, 0x68, 0x65, 0x03, 0x45, 0x6e, 0x67, 0x03, 0x65, 0x6e, 0x67, 0x07, 0x4f, 0x6d, 0x61,
+    0x63, 0x72, 0x6f, 0x6e, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x4f, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67,
+    0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72,
+    0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x0c, 0x52, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e,
+    0x74, 0x0c, 0x72, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x52,
+    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x53, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63,
+    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
+    0x65, 0x78, 0x0c, 0x54, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c,
+    0x74, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x54, 0x63, 0x61,
+    0x72, 0x6f, 0x6e, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x04, 0x54, 0x62, 0x61, 0x72, 0x04,
+    0x74, 0x62, 0x61, 0x72, 0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x75, 0x74, 0x69, 0x6c,
+    0x64, 0x65, 0x07, 0x55, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6d, 0x61, 0x63, 0x72,
+    0x6f, 0x6e, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x05, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x0d, 0x55, 0x68, 0x75,
+    0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67,
+    0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+    0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+    0x66, 0x6c, 0x65, 0x78, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+    0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x79, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x7a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
+    0x74, 0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x05, 0x6c, 0x6f, 0x6e,
+    0x67, 0x73, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
+    0x37, 0x45, 0x05, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0d, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69,
+    0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e, 0x6f,
+    0x73, 0x09, 0x61, 0x6e, 0x6f, 0x74, 0x65, 0x6c, 0x65, 0x69, 0x61, 0x0c, 0x45, 0x70, 0x73, 0x69,
+    0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x45, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f,
+    0x73, 0x09, 0x49, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x4f, 0x6d, 0x69, 0x63,
+    0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e,
+    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
+    0x11, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e,
+    0x6f, 0x73, 0x05, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x04, 0x42, 0x65, 0x74, 0x61, 0x05, 0x47, 0x61,
+    0x6d, 0x6d, 0x61, 0x07, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x5a, 0x65, 0x74, 0x61,
+    0x03, 0x45, 0x74, 0x61, 0x05, 0x54, 0x68, 0x65, 0x74, 0x61, 0x04, 0x49, 0x6f, 0x74, 0x61, 0x05,
+    0x4b, 0x61, 0x70, 0x70, 0x61, 0x06, 0x4c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02, 0x4d, 0x75, 0x02,
+    0x4e, 0x75, 0x02, 0x58, 0x69, 0x07, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x02, 0x50, 0x69,
+    0x03, 0x52, 0x68, 0x6f, 0x05, 0x53, 0x69, 0x67, 0x6d, 0x61, 0x03, 0x54, 0x61, 0x75, 0x07, 0x55,
+    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x50, 0x68, 0x69, 0x03, 0x43, 0x68, 0x69, 0x03, 0x50,
+    0x73, 0x69, 0x0c, 0x49, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f,
+    0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0a,
+    0x61, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x65, 0x70, 0x73, 0x69, 0x6c,
+    0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x65, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
+    0x09, 0x69, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x14, 0x75, 0x70, 0x73, 0x69, 0x6c,
+    0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x05,
+    0x61, 0x6c, 0x70, 0x68, 0x61, 0x04, 0x62, 0x65, 0x74, 0x61, 0x05, 0x67, 0x61, 0x6d, 0x6d, 0x61,
+    0x05, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x07, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x7a,
+    0x65, 0x74, 0x61, 0x03, 0x65, 0x74, 0x61, 0x05, 0x74, 0x68, 0x65, 0x74, 0x61, 0x04, 0x69, 0x6f,
+    0x74, 0x61, 0x05, 0x6b, 0x61, 0x70, 0x70, 0x61, 0x06, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02,
+    0x6e, 0x75, 0x02, 0x78, 0x69, 0x07, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x03, 0x72, 0x68,
+    0x6f, 0x06, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x05, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x03, 0x74,
+    0x61, 0x75, 0x07, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x70, 0x68, 0x69, 0x03, 0x63,
+    0x68, 0x69, 0x03, 0x70, 0x73, 0x69, 0x05, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x0c, 0x69, 0x6f, 0x74,
+    0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f,
+    0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0c, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f,
+    0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f,
+    0x6e, 0x6f, 0x73, 0x0a, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x34, 0x30, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x33,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x31, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x35, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x33, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x35, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x36, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x35, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x38,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x35, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x36, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x36, 0x31, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x34, 0x30, 0x44, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x36, 0x32,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x34, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x31, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x31, 0x38, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x31, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x32, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x31, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x32, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x34,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x32, 0x36, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x37, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x32, 0x38, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x32, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x30, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x33, 0x31, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x32,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x33, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x33, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x35, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x36, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x33, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x33, 0x38, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x33, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x30,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x31, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x34, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x33, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x34, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x36, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x34, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x38,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x34, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x36, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x36, 0x36, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x36, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x36, 0x38, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x36, 0x39, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x37, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x32,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x33, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x37, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x35, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x36, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x37, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x38, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x37, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x30,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x31, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x38, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x33, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x38, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x36, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x38, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x38,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x38, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x30, 0x39, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x31, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30,
+    0x39, 0x33, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x34, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x39, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x36,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
+    0x35, 0x30, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x37, 0x31, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x30, 0x39, 0x39, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x30,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x31, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31,
+    0x30, 0x31, 0x30, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x33, 0x09, 0x61,
+    0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x34, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31,
+    0x30, 0x35, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x36, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x31, 0x30, 0x37, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x38,
+    0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
+    0x35, 0x44, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x31, 0x31, 0x30, 0x09, 0x61, 0x66, 0x69,
+    0x69, 0x31, 0x30, 0x31, 0x39, 0x33, 0x09, 0x61, 0x66, 0x69, 0x69, 0x30, 0x30, 0x32, 0x30, 0x38,
+    0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x46, 0x09, 0x61, 0x66,
+    0x69, 0x69, 0x36, 0x31, 0x33, 0x35, 0x32, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x6c, 0x65, 0x66,
+    0x74, 0x07, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x75, 0x70, 0x0a, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x72,
+    0x69, 0x67, 0x68, 0x74, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x64, 0x6f, 0x77, 0x6e, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x32, 0x30, 0x36, 0x07, 0x74, 0x72, 0x69, 0x61, 0x67, 0x75, 0x70, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x35, 0x42, 0x36, 0x07, 0x74, 0x72, 0x69, 0x61, 0x67, 0x64, 0x6e, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x35, 0x43, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x30, 0x35, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x36, 0x30, 0x36, 0x05, 0x73, 0x70, 0x61, 0x64, 0x65, 0x04, 0x63, 0x6c, 0x75,
+    0x62, 0x05, 0x68, 0x65, 0x61, 0x72, 0x74, 0x07, 0x64, 0x69, 0x61, 0x6d, 0x6f, 0x6e, 0x64, 0x0b,
+    0x6d, 0x75, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x6e, 0x6f, 0x74, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x46,
+    0x31, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x31, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x46,
+    0x38, 0x46, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x46,
+    0x42, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01,
+    0x02, 0x2e, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x3d, 0xa2, 0xcf,
+    0x00, 0x00, 0x00, 0x00, 0xca, 0x1b, 0x1c, 0xde, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xb6, 0x25, 0x77,
+};
+
+namespace EmbeddedAssets
+{
+    const EmbeddedAsset UI = {UI_DATA, sizeof(UI_DATA)};
+    const EmbeddedAsset UI2 = {UI2_DATA, sizeof(UI2_DATA)};
+    const EmbeddedAsset Cursors = {CURSORS_DATA, sizeof(CURSORS_DATA)};
+    const EmbeddedAsset Tiles = {TILES_DATA, sizeof(TILES_DATA)};
+    const EmbeddedAsset Font = {FONT_DATA, sizeof(FONT_DATA)};
+}
\ No newline at end of file
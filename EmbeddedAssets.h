@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+
+// Asset files compiled into the binary, so it runs from any working directory
+// EmbeddedAssets.cpp is generated from the Assets folder by Assets/embed_assets.py
+struct EmbeddedAsset
+{
+    const unsigned char *data;
+    std::size_t size;
+};
+
+namespace EmbeddedAssets
+{
+    extern const EmbeddedAsset UI;
+    extern const EmbeddedAsset UI2;
+    extern const EmbeddedAsset Cursors;
+    extern const EmbeddedAsset Tiles;
+    extern const EmbeddedAsset Font;
+}
\ No newline at end of file
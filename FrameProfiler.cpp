@@ -0,0 +1,96 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    const float PIXELS_PER_MS = 4.0f;
+    const float BAR_WIDTH = 3.0f;
+    const float GRAPH_HEIGHT = 100.0f;
+    const float FRAME_BUDGET_MS = 1000.0f / 60.0f;
+
+    const sf::Color SECTION_COLORS[FrameProfiler::SECTIONS] = {
+        sf::Color(0x4F, 0xC3, 0xF7),  // Input
+        sf::Color(0xFF, 0x8A, 0x65),  // Search
+        sf::Color(0xAE, 0xD5, 0x81),  // Agent
+        sf::Color(0xBA, 0x68, 0xC8)}; // Draw
+
+    const char *SECTION_NAMES[FrameProfiler::SECTIONS] = {"input", "search", "agent", "draw"};
+
+    void appendQuad(sf::VertexArray &quads, float x, float y, float width, float height, sf::Color color)
+    {
+        quads.append(sf::Vertex(sf::Vector2f(x, y), color));
+        quads.append(sf::Vertex(sf::Vector2f(x + width, y), color));
+        quads.append(sf::Vertex(sf::Vector2f(x + width, y + height), color));
+        quads.append(sf::Vertex(sf::Vector2f(x, y + height), color));
+    }
+}
+
+void FrameProfiler::begin(Section section)
+{
+    float elapsed = clock.restart().asMicroseconds() / 1000.0f;
+    if (current != Section::Idle)
+        frame[static_cast<int>(current)] += elapsed;
+
+    current = section;
+}
+
+void FrameProfiler::endFrame()
+{
+    begin(Section::Idle);
+
+    history[next] = frame;
+    next = (next + 1) % HISTORY;
+    recorded = std::min(recorded + 1, HISTORY);
+    frame = {};
+}
+
+void FrameProfiler::draw(sf::RenderWindow &window, const sf::Font &font)
+{
+    if (!visible)
+        return;
+
+    const float left = 10.0f;
+    const float top = 10.0f;
+    const float bottom = top + GRAPH_HEIGHT;
+
+    sf::VertexArray quads(sf::Quads);
+    appendQuad(quads, left - 5, top - 5, HISTORY * BAR_WIDTH + 200, GRAPH_HEIGHT + 10, sf::Color(0, 0, 0, 200));
+
+    // One stacked bar per frame, oldest on the left, clipped to the graph height
+    Sample average = {};
+    for (int i = 0; i < recorded; ++i)
+    {
+        const Sample &sample = history[(next - recorded + i + HISTORY) % HISTORY];
+        float x = left + (HISTORY - recorded + i) * BAR_WIDTH;
+        float y = bottom;
+
+        for (int s = 0; s < SECTIONS; ++s)
+        {
+            average[s] += sample[s] / recorded;
+
+            float height = std::min(sample[s] * PIXELS_PER_MS, y - top);
+            y -= height;
+            appendQuad(quads, x, y, BAR_WIDTH - 1, height, SECTION_COLORS[s]);
+        }
+    }
+
+    // Frame budget at 60 FPS
+    appendQuad(quads, left, bottom - FRAME_BUDGET_MS * PIXELS_PER_MS, HISTORY * BAR_WIDTH, 1, sf::Color::White);
+    window.draw(quads);
+
+    // Legend with the average of every section over the history
+    sf::Text label;
+    label.setFont(font);
+    label.setCharacterSize(10);
+
+    char line[32];
+    for (int s = 0; s < SECTIONS; ++s)
+    {
+        std::snprintf(line, sizeof(line), "%-6s %6.2f ms", SECTION_NAMES[s], average[s]);
+        label.setString(line);
+        label.setFillColor(SECTION_COLORS[s]);
+        label.setPosition(left + HISTORY * BAR_WIDTH + 10, top + 5 + s * 20);
+        window.draw(label);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+
+// Splits every frame of the editor loop into input, search, agent update and draw time
+// and keeps the last HISTORY frames, drawn as a stacked bar graph over the grid (F1)
+class FrameProfiler
+{
+public:
+    enum class Section
+    {
+        Input,
+        Search,
+        Agent,
+        Draw,
+        Idle // Waiting for input or for the frame period, not recorded
+    };
+
+    static const int SECTIONS = 4;
+    static const int HISTORY = 120;
+
+    FrameProfiler() : history(HISTORY) {}
+
+    // Close the running section and start timing the next one
+    void begin(Section section);
+
+    // Close the running section and record the frame, time until the next begin is Idle
+    void endFrame();
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    void draw(sf::RenderWindow &window, const sf::Font &font);
+
+private:
+    typedef std::array<float, SECTIONS> Sample; // Milliseconds per section
+
+    sf::Clock clock;
+    Section current = Section::Idle;
+    Sample frame = {};
+
+    std::vector<Sample> history; // Ring buffer, next is the oldest sample
+    int next = 0;
+    int recorded = 0;
+
+    bool visible = false;
+};
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "FrameScheduler.h"
+
+bool FrameScheduler::waitEvent(sf::Event &event)
+{
+    if (redraw || awake)
+        return false;
+
+    // Nothing changes until the user does something, sleep in the window system
+    if (window.waitEvent(event))
+    {
+        // Time spent waiting does not belong to the new frame
+        frameClock.restart();
+        redraw = true;
+        return true;
+    }
+    return false;
+}
+
+bool FrameScheduler::pollEvent(sf::Event &event)
+{
+    if (window.pollEvent(event))
+    {
+        // Any input can move the cursor sprite or change the menu
+        redraw = true;
+        return true;
+    }
+    return false;
+}
+
+void FrameScheduler::endFrame()
+{
+    sf::Time elapsed = frameClock.getElapsedTime();
+    if (elapsed < framePeriod)
+        sf::sleep(framePeriod - elapsed);
+
+    frameClock.restart();
+    redraw = false;
+    awake = false;
+}
\ No newline at end of file
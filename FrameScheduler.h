@@ -0,0 +1,38 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Decides when the editor loop runs and when it redraws
+// With nothing animating the loop sleeps in waitEvent until the next input arrives,
+// otherwise every iteration is stretched to the frame period so animations run at most at maxFps
+class FrameScheduler
+{
+public:
+    FrameScheduler(sf::RenderWindow &window, int maxFps = 60) :
+        window(window), framePeriod(sf::seconds(1.0f / maxFps)) {}
+
+    // Blocks until the next event when the previous frame left nothing to do
+    // Returns true with the event that woke the loop up
+    bool waitEvent(sf::Event &event);
+
+    // Remaining events of this frame, never blocks
+    bool pollEvent(sf::Event &event);
+
+    // The scene changed and has to be drawn again
+    void requestRedraw() { redraw = true; }
+
+    // Something advances on its own (trace replay, character walk), do not block on input next frame
+    void keepAwake() { awake = true; }
+
+    bool needsRedraw() const { return redraw; }
+
+    // Sleeps out the rest of the frame period and starts the next frame
+    void endFrame();
+
+private:
+    sf::RenderWindow &window;
+    sf::Time framePeriod;
+    sf::Clock frameClock;
+
+    bool redraw = true; // The first frame is always drawn
+    bool awake = false;
+};
\ No newline at end of file
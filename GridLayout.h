@@ -0,0 +1,155 @@
+#pragma once
+#include <cstdint>
+
+// Order in which the cells of a grid are stored, used by SearchGrid (see SearchGrid.h)
+// A layout maps (row, col) to a cell id in [0, size()) and steps from a cell to its neighbours
+// directly on the id. Ids that don't belong to a cell (padding) are never visited
+
+// Row after row: left and right neighbours are adjacent in memory, but up and down are a whole
+// row apart, so on wide maps every vertical step of a search touches another cache line
+struct RowMajorLayout
+{
+    static const char *name() { return "row-major"; }
+
+    RowMajorLayout(int rows, int cols) : rows(rows), cols(cols) {}
+
+    int size() const { return rows * cols; }
+    int index(int row, int col) const { return row * cols + col; }
+    int row(int id) const { return id / cols; }
+    int col(int id) const { return id % cols; }
+
+    // Up, down, left and right, in the same order as Pathfinder::getAdjacentNodes
+    template <typename Visit>
+    void forEachNeighbor(int id, Visit &&visit) const
+    {
+        int col = id % cols;
+        if (id >= cols)
+            visit(id - cols);
+        if (id < size() - cols)
+            visit(id + cols);
+        if (col > 0)
+            visit(id - 1);
+        if (col < cols - 1)
+            visit(id + 1);
+    }
+
+    int rows;
+    int cols;
+};
+
+// Z-order (Morton) curve: the bits of the row and the column are interleaved, so every aligned
+// 2^k x 2^k block of cells is contiguous in memory and most neighbours share a cache line
+// Both sizes are rounded up to powers of two; when one is larger, its extra high bits are
+// placed above the interleaved ones, which keeps the padding below 4x the map
+struct MortonLayout
+{
+    static const char *name() { return "morton"; }
+
+    MortonLayout(int rows, int cols) : rows(rows), cols(cols)
+    {
+        int rowBits = bitsFor(rows);
+        int colBits = bitsFor(cols);
+        sharedBits = rowBits < colBits ? rowBits : colBits;
+        rowsLonger = rowBits > colBits;
+        totalBits = rowBits + colBits;
+
+        // Column bits are the even ones of the interleaved part, row bits the odd ones
+        uint32_t interleaved = sharedBits ? uint32_t((uint64_t(1) << (2 * sharedBits)) - 1) : 0;
+        uint32_t high = uint32_t(((uint64_t(1) << totalBits) - 1) & ~uint64_t(interleaved));
+        colMask = (interleaved & 0x55555555u) | (rowsLonger ? 0 : high);
+        rowMask = (interleaved & 0xAAAAAAAAu) | (rowsLonger ? high : 0);
+        lastRow = rows > 0 ? index(rows - 1, 0) : 0;
+        lastCol = cols > 0 ? index(0, cols - 1) : 0;
+    }
+
+    int size() const { return int(uint32_t(1) << totalBits); }
+
+    int index(int row, int col) const
+    {
+        uint32_t low = (uint32_t(1) << sharedBits) - 1;
+        uint32_t longer = rowsLonger ? row : col;
+        return int(spread(col & low) | spread(row & low) << 1 | (longer >> sharedBits) << (2 * sharedBits));
+    }
+
+    int row(int id) const
+    {
+        uint32_t value = compact((uint32_t(id) >> 1) & lowEven());
+        return int(rowsLonger ? value | (uint32_t(id) >> (2 * sharedBits)) << sharedBits : value);
+    }
+
+    int col(int id) const
+    {
+        uint32_t value = compact(uint32_t(id) & lowEven());
+        return int(rowsLonger ? value : value | (uint32_t(id) >> (2 * sharedBits)) << sharedBits);
+    }
+
+    // Steps add or subtract one in the dilated row or column bits: filling the other bits with
+    // ones carries an increment straight through them, and masking a decrement keeps only its own bits
+    template <typename Visit>
+    void forEachNeighbor(int id, Visit &&visit) const
+    {
+        uint32_t cell = id;
+        uint32_t rowPart = cell & rowMask;
+        uint32_t colPart = cell & colMask;
+        if (rowPart != 0)
+            visit(int(((rowPart - 1) & rowMask) | colPart));
+        if (rowPart != lastRow)
+            visit(int((((cell | ~rowMask) + 1) & rowMask) | colPart));
+        if (colPart != 0)
+            visit(int(((colPart - 1) & colMask) | rowPart));
+        if (colPart != lastCol)
+            visit(int((((cell | ~colMask) + 1) & colMask) | rowPart));
+    }
+
+    int rows;
+    int cols;
+
+private:
+    static int bitsFor(int size)
+    {
+        int bits = 0;
+        while ((1 << bits) < size)
+        {
+            ++bits;
+        }
+        return bits;
+    }
+
+    // 0b1111 -> 0b01010101
+    static uint32_t spread(uint32_t x)
+    {
+        x = (x | (x << 8)) & 0x00FF00FFu;
+        x = (x | (x << 4)) & 0x0F0F0F0Fu;
+        x = (x | (x << 2)) & 0x33333333u;
+        x = (x | (x << 1)) & 0x55555555u;
+        return x;
+    }
+
+    // 0b01010101 -> 0b1111
+    static uint32_t compact(uint32_t x)
+    {
+        x &= 0x55555555u;
+        x = (x | (x >> 1)) & 0x33333333u;
+        x = (x | (x >> 2)) & 0x0F0F0F0Fu;
+        x = (x | (x >> 4)) & 0x00FF00FFu;
+        x = (x | (x >> 8)) & 0x0000FFFFu;
+        return x;
+    }
+
+    uint32_t lowEven() const { return uint32_t((uint64_t(1) << (2 * sharedBits)) - 1) & 0x55555555u; }
+
+    int sharedBits;
+    int totalBits;
+    bool rowsLonger;
+    uint32_t rowMask;
+    uint32_t colMask;
+    uint32_t lastRow;
+    uint32_t lastCol;
+};
+
+// The layout used by SearchGrid, picked at compile time with -DPATHFINDER_MORTON_LAYOUT
+#ifdef PATHFINDER_MORTON_LAYOUT
+using CellLayout = MortonLayout;
+#else
+using CellLayout = RowMajorLayout;
+#endif
\ No newline at end of file
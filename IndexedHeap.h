@@ -0,0 +1,135 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <memory_resource>
+
+// Indexed d-ary min-heap of cell ids with decrease-key
+// Every id appears at most once, so the heap never holds more entries than open cells
+// and there are no outdated entries to skip when popping
+template <typename Key, int Arity = 4>
+class IndexedHeap
+{
+public:
+    // Ids must be in the range [0, capacity); the arrays are allocated from the given resource
+    explicit IndexedHeap(int capacity, std::pmr::memory_resource *resource = std::pmr::get_default_resource()) :
+        heap(resource), position(capacity, -1, resource) {}
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    int size() const
+    {
+        return heap.size();
+    }
+
+    bool contains(int id) const
+    {
+        return position[id] != -1;
+    }
+
+    int top() const
+    {
+        return heap[0].second;
+    }
+
+    const Key &topKey() const
+    {
+        return heap[0].first;
+    }
+
+    // Insert the id, or lower its key if it is already in the heap
+    void push(int id, const Key &key)
+    {
+        if (position[id] == -1)
+        {
+            position[id] = heap.size();
+            heap.emplace_back(key, id);
+            siftUp(position[id]);
+        }
+        else if (key < heap[position[id]].first)
+        {
+            heap[position[id]].first = key;
+            siftUp(position[id]);
+        }
+    }
+
+    int pop()
+    {
+        int id = heap[0].second;
+        position[id] = -1;
+
+        if (heap.size() > 1)
+        {
+            heap[0] = heap.back();
+            position[heap[0].second] = 0;
+            heap.pop_back();
+            siftDown(0);
+        }
+        else
+        {
+            heap.pop_back();
+        }
+
+        return id;
+    }
+
+private:
+    void siftUp(int index)
+    {
+        std::pair<Key, int> entry = heap[index];
+        while (index > 0)
+        {
+            int parent = (index - 1) / Arity;
+            if (!(entry.first < heap[parent].first))
+            {
+                break;
+            }
+            heap[index] = heap[parent];
+            position[heap[index].second] = index;
+            index = parent;
+        }
+        heap[index] = entry;
+        position[entry.second] = index;
+    }
+
+    void siftDown(int index)
+    {
+        std::pair<Key, int> entry = heap[index];
+        const int count = heap.size();
+        while (true)
+        {
+            int first = index * Arity + 1;
+            if (first >= count)
+            {
+                break;
+            }
+
+            // Find the smallest child
+            int best = first;
+            int last = std::min(first + Arity, count);
+            for (int child = first + 1; child < last; ++child)
+            {
+                if (heap[child].first < heap[best].first)
+                {
+                    best = child;
+                }
+            }
+
+            if (!(heap[best].first < entry.first))
+            {
+                break;
+            }
+            heap[index] = heap[best];
+            position[heap[index].second] = index;
+            index = best;
+        }
+        heap[index] = entry;
+        position[entry.second] = index;
+    }
+
+    std::pmr::vector<std::pair<Key, int>> heap;
+    std::pmr::vector<int> position; // Index of each id in the heap, -1 if absent
+};
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "LearnedHeuristic.h"
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    const char MAGIC[4] = {'P', 'F', 'L', 'H'};
+    const uint32_t VERSION = 1;
+}
+
+int LearnedHeuristic::get(int cell, int goal) const
+{
+    auto table = tables.find(goal);
+    if (table != tables.end())
+    {
+        auto value = table->second.find(cell);
+        if (value != table->second.end())
+        {
+            return value->second;
+        }
+    }
+    return manhattan(cell, goal);
+}
+
+void LearnedHeuristic::set(int cell, int goal, int value)
+{
+    // Values that match the default are not worth storing
+    if (value == manhattan(cell, goal))
+    {
+        auto table = tables.find(goal);
+        if (table != tables.end())
+        {
+            table->second.erase(cell);
+        }
+        return;
+    }
+    tables[goal][cell] = value;
+}
+
+size_t LearnedHeuristic::size() const
+{
+    size_t count = 0;
+    for (const auto &table : tables)
+    {
+        count += table.second.size();
+    }
+    return count;
+}
+
+// Magic, version, rows, cols, goal count, then per goal: goal, entry count, (cell, value) pairs
+bool LearnedHeuristic::save(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    auto write = [&](uint32_t value)
+    {
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+
+    file.write(MAGIC, 4);
+    write(VERSION);
+    write(rows);
+    write(cols);
+    write(tables.size());
+
+    for (const auto &table : tables)
+    {
+        write(table.first);
+        write(table.second.size());
+        for (const auto &entry : table.second)
+        {
+            write(entry.first);
+            write(entry.second);
+        }
+    }
+    return bool(file);
+}
+
+bool LearnedHeuristic::load(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[4] = {};
+    if (!file.read(magic, 4) || std::memcmp(magic, MAGIC, 4) != 0)
+    {
+        return false;
+    }
+
+    auto read = [&](uint32_t &value)
+    {
+        return bool(file.read(reinterpret_cast<char *>(&value), sizeof(value)));
+    };
+
+    uint32_t version, fileRows, fileCols, goalCount;
+    if (!read(version) || !read(fileRows) || !read(fileCols) || !read(goalCount) ||
+        version != VERSION || int(fileRows) != rows || int(fileCols) != cols)
+    {
+        return false;
+    }
+
+    std::unordered_map<int, std::unordered_map<int, int>> loaded;
+    for (uint32_t i = 0; i < goalCount; ++i)
+    {
+        uint32_t goal, count;
+        if (!read(goal) || !read(count) || goal >= uint32_t(rows * cols))
+        {
+            return false;
+        }
+
+        std::unordered_map<int, int> &table = loaded[goal];
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            uint32_t cell, value;
+            if (!read(cell) || !read(value) || cell >= uint32_t(rows * cols))
+            {
+                return false;
+            }
+            table[cell] = value;
+        }
+    }
+
+    tables.swap(loaded);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <cstdlib>
+
+// Heuristic values learned by real-time agents on one map, per goal
+// Nodes that were never updated fall back to the Manhattan distance; the table can be saved
+// next to the map so later trips start from what earlier ones learned
+class LearnedHeuristic
+{
+public:
+    LearnedHeuristic(int rows, int cols) : rows(rows), cols(cols) {}
+
+    int get(int cell, int goal) const;
+    void set(int cell, int goal, int value);
+
+    // Forget everything, learned values can overestimate after walls are removed
+    void clear() { tables.clear(); }
+
+    size_t size() const;
+
+    // False if the file cannot be written, or read back for a map of this size
+    bool save(const std::string &path) const;
+    bool load(const std::string &path);
+
+private:
+    int manhattan(int cell, int goal) const
+    {
+        return std::abs(cell / cols - goal / cols) + std::abs(cell % cols - goal % cols);
+    }
+
+    int rows;
+    int cols;
+    std::unordered_map<int, std::unordered_map<int, int>> tables; // goal -> cell -> value
+};
\ No newline at end of file
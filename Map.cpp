@@ -1,10 +1,13 @@
 #include "Map.h"
+#include "EmbeddedAssets.h"
+#include "MapFile.h"
+#include "Bresenham.h"
+#include <cstdio>
 
 void Map::updateNodes(sf::RenderWindow &window)
 {
-    // Bresenham's Line Algorithm is used to efficiently calculate the coordinates of a line between two points.
-    // The basic idea behind the algorithm is to determine which pixels should be filled in along the
-    // line between two points on a grid
+    // The nodes between the previous and current mouse positions are updated along a
+    // Bresenham line (see Bresenham.h), so fast strokes don't leave gaps
 
     sf::Vector2i currentPosition = sf::Mouse::getPosition(window);
     static sf::Vector2i previousPosition = currentPosition;
@@ -15,28 +18,13 @@ void Map::updateNodes(sf::RenderWindow &window)
     int x2 = currentPosition.x / NODE_SIZE_X;
     int y2 = currentPosition.y / NODE_SIZE_Y;
 
-    // Calculate the differences between the target and current positions
-    int dx = abs(x2 - x1);
-    int dy = abs(y2 - y1);
-    
-    // Determine the directional increments for x and y
-    int sx = (x1 < x2) ? 1 : -1;
-    int sy = (y1 < y2) ? 1 : -1;
-
-    // Error term for linear interpolation
-    int error = dx - dy;
-    
-    // Initialize starting positions
-    int x = x1;
-    int y = y1;
-
-    while (true)
+    traceLine(x1, y1, x2, y2, [&](int x, int y)
     {
         // Check if the current position is within the grid bounds
         if (x >= 0 && x < GRID_COLS && y >= 0 && y < GRID_ROWS)
         {
             Node &node = grid[y][x];
-            
+
             // Update the node based on the tool type and mouse button
             if (sf::Mouse::isButtonPressed(sf::Mouse::Left) && !startSearch)
             {
@@ -45,11 +33,20 @@ void Map::updateNodes(sf::RenderWindow &window)
                     if (node.type == Node::NodeType::Empty)
                     {
                         node.type = Node::NodeType::Wall;
+                        updateClearance(grid, y, x);
+                        subgoalGraph.update(y, x);
                     }
                 }
                 else if (tool_type == ToolType::Eraser)
                 {
-                    if (node.type == Node::NodeType::Wall || node.type == Node::NodeType::Start || node.type == Node::NodeType::End)
+                    if (node.type == Node::NodeType::Wall)
+                    {
+                        node.type = Node::NodeType::Empty;
+                        updateClearance(grid, y, x);
+                        subgoalGraph.update(y, x);
+                        learnedHeuristic.clear();
+                    }
+                    else if (node.type == Node::NodeType::Start || node.type == Node::NodeType::End)
                     {
                         node.type = Node::NodeType::Empty;
                     }
@@ -63,7 +60,8 @@ void Map::updateNodes(sf::RenderWindow &window)
                 }
                 else if (tool_type == ToolType::EndFlag)
                 {
-                    if (node.type == Node::NodeType::Empty && !hasEndNode())
+                    // Several end nodes can be placed, searches stop at the nearest one
+                    if (node.type == Node::NodeType::Empty)
                     {
                         node.type = Node::NodeType::End;
                     }
@@ -71,25 +69,8 @@ void Map::updateNodes(sf::RenderWindow &window)
             }
         }
 
-        // Exit loop if the current position matches the target
-        if (x == x2 && y == y2)
-        {
-            break;
-        }
-
-        // Apply linear interpolation
-        int e2 = 2 * error;
-        if (e2 > -dy)
-        {
-            error -= dy;
-            x += sx;
-        }
-        if (e2 < dx)
-        {
-            error += dx;
-            y += sy;
-        }
-    }
+        return true;
+    });
 
     // Update the previous mouse position for the next iteration
     previousPosition = currentPosition;
@@ -136,29 +117,29 @@ void Map::updateTools(sf::RenderWindow &window)
         {
             tool_type = ToolType::Pencil;
             window.setMouseCursorVisible(false);
-            cursor_sprite.setTexture(txtManager.cursor_texture);
-            cursor_sprite.setTextureRect(sf::IntRect(0, 1, 20, 25));
+            cursor_sprite.setTexture(txtManager.atlas);
+            cursor_sprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Cursors, 0, 1, 20, 25));
         }
         else if (erase_sprite.getGlobalBounds().contains(cursor_sprite.getPosition()) && !startSearch)
         {
             tool_type = ToolType::Eraser;
             window.setMouseCursorVisible(false);
-            cursor_sprite.setTexture(txtManager.cursor_texture);
-            cursor_sprite.setTextureRect(sf::IntRect(22, 2, 16, 24));
+            cursor_sprite.setTexture(txtManager.atlas);
+            cursor_sprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Cursors, 22, 2, 16, 24));
         }
         else if (start_flag_sprite.getGlobalBounds().contains(cursor_sprite.getPosition()) && !startSearch)
         {
             tool_type = ToolType::StartFlag;
             window.setMouseCursorVisible(false);
-            cursor_sprite.setTexture(txtManager.cursor_texture);
-            cursor_sprite.setTextureRect(sf::IntRect(4, 28, 16, 26));
+            cursor_sprite.setTexture(txtManager.atlas);
+            cursor_sprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Cursors, 4, 28, 16, 26));
         }
         else if (end_flag_sprite.getGlobalBounds().contains(cursor_sprite.getPosition()) && !startSearch)
         {
             tool_type = ToolType::EndFlag;
             window.setMouseCursorVisible(false);
-            cursor_sprite.setTexture(txtManager.cursor_texture);
-            cursor_sprite.setTextureRect(sf::IntRect(22, 28, 16, 26));
+            cursor_sprite.setTexture(txtManager.atlas);
+            cursor_sprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Cursors, 22, 28, 16, 26));
         }
         else if (start_text.getGlobalBounds().contains(cursor_sprite.getPosition()))
         {
@@ -178,6 +159,14 @@ void Map::updateTools(sf::RenderWindow &window)
 }
 
 void Map::emptyMap(std::vector<std::vector<Node>> &grid)
+{
+    clearMap(grid);
+    computeClearance(grid);
+    subgoalGraph.build();
+}
+
+// Empties the nodes and resets the editor state, the caller fills the map and builds the subgoal graph once
+void Map::clearMap(std::vector<std::vector<Node>> &grid)
 {
     for (auto &row : grid)
     {
@@ -187,11 +176,96 @@ void Map::emptyMap(std::vector<std::vector<Node>> &grid)
         }
     }
 
+    resetTrace();
+    learnedHeuristic.clear();
+
     startSearch = false;
     startMiniDungeon = false;
     tool_type = ToolType::None;
 }
 
+// Visited and path nodes are not saved, only walls, start and end nodes
+// The learned heuristic goes to a side table next to the map, removed when there is nothing learned
+bool Map::saveMap(const std::string &path)
+{
+    if (!MapFile::save(path, grid))
+    {
+        return false;
+    }
+    if (learnedHeuristic.size() == 0)
+    {
+        std::remove((path + ".lrta").c_str());
+        return true;
+    }
+    return learnedHeuristic.save(path + ".lrta");
+}
+
+// Maps of another size are cropped to the editor grid
+bool Map::loadMap(const std::string &path)
+{
+    MapFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    clearMap(grid);
+    file.toGrid(grid);
+    computeClearance(grid);
+    subgoalGraph.build();
+
+    // A missing side table, or one for a map of another size, leaves nothing learned
+    learnedHeuristic.load(path + ".lrta");
+    return true;
+}
+
+void Map::generate()
+{
+    clearMap(grid);
+    generateMap(grid, map_style, mapSeed);
+    subgoalGraph.build();
+    std::cout << "Generated " << mapStyleName(map_style) << " map, seed " << mapSeed << std::endl;
+    ++mapSeed;
+}
+
+void Map::resetTrace()
+{
+    searchTrace.clear();
+    traceCursor = 0;
+    characterPath.clear();
+    characterStep = characterPath.begin();
+}
+
+// Apply the next replaySpeed events of the search trace to the grid
+// Returns false once the whole trace has been replayed
+bool Map::replayTrace()
+{
+    size_t end = std::min(searchTrace.events.size(), traceCursor + replaySpeed);
+    if (traceCursor == end)
+        return false;
+
+    for (; traceCursor < end; ++traceCursor)
+    {
+        uint32_t entry = searchTrace.events[traceCursor];
+        int id = SearchTrace::cellOf(entry);
+        Node &node = grid[id / searchTrace.cols][id % searchTrace.cols];
+
+        if (SearchTrace::eventOf(entry) == SearchTrace::Event::Path)
+        {
+            if (node.type != Node::NodeType::Start && node.type != Node::NodeType::End)
+            {
+                node.type = Node::NodeType::Path;
+            }
+        }
+        else if (node.type == Node::NodeType::Empty)
+        {
+            node.type = Node::NodeType::Visited;
+        }
+    }
+
+    return true;
+}
+
 void Map::drawNodes(sf::RenderWindow &window, std::vector<std::vector<Node>> &grid)
 {
     for (auto &row : grid)
@@ -243,50 +317,36 @@ void Map::drawGrid(sf::RenderWindow &window)
     }
 }
 
-void Map::drawMenu(sf::RenderWindow &window)
+// Everything in the menu that does not depend on the editor state, set up once
+void Map::initMenu()
 {
     menu.setSize(sf::Vector2f(WINDOW_WIDTH, 180));
     menu.setFillColor(MENU_BACKGROUND_COLOR);
     menu.setPosition(0, GRID_ROWS * NODE_SIZE_Y);
 
-    if (!startSearch)
-    {
-        pencil_sprite.setTexture(txtManager.icons_texture);
-        erase_sprite.setTexture(txtManager.icons_texture);
-        end_flag_sprite.setTexture(txtManager.icons_texture);
-        start_flag_sprite.setTexture(txtManager.icons_texture);
-        dungeon_sprite.setTexture(txtManager.no_icons_texture);
-    }
-    else
-    {
-        pencil_sprite.setTexture(txtManager.no_icons_texture);
-        erase_sprite.setTexture(txtManager.no_icons_texture);
-        end_flag_sprite.setTexture(txtManager.no_icons_texture);
-        start_flag_sprite.setTexture(txtManager.no_icons_texture);
-        dungeon_sprite.setTexture(txtManager.icons_texture);
-    }
+    // All the icons come from the atlas, their rects are set by drawMenu
+    pencil_sprite.setTexture(txtManager.atlas);
+    erase_sprite.setTexture(txtManager.atlas);
+    end_flag_sprite.setTexture(txtManager.atlas);
+    start_flag_sprite.setTexture(txtManager.atlas);
+    dungeon_sprite.setTexture(txtManager.atlas);
 
-    pencil_sprite.setTextureRect(sf::IntRect(0, 0, 24, 24));
     pencil_sprite.setScale(3.0f, 3.0f);
     pencil_sprite.setPosition(700, GRID_ROWS * NODE_SIZE_Y + 20);
 
-    erase_sprite.setTextureRect(sf::IntRect(26, 0, 24, 24));
     erase_sprite.setScale(3.0f, 3.0f);
     erase_sprite.setPosition(800, GRID_ROWS * NODE_SIZE_Y + 20);
 
-    end_flag_sprite.setTextureRect(sf::IntRect(0, 26, 24, 24));
     end_flag_sprite.setScale(3.0f, 3.0f);
     end_flag_sprite.setPosition(900, GRID_ROWS * NODE_SIZE_Y + 20);
 
-    start_flag_sprite.setTextureRect(sf::IntRect(26, 26, 24, 24));
     start_flag_sprite.setScale(3.0f, 3.0f);
     start_flag_sprite.setPosition(1000, GRID_ROWS * NODE_SIZE_Y + 20);
 
-    dungeon_sprite.setTextureRect(sf::IntRect(0, 52, 24, 24));
     dungeon_sprite.setScale(3.0f, 3.0f);
     dungeon_sprite.setPosition(1100, GRID_ROWS * NODE_SIZE_Y + 20);
 
-    font.loadFromFile("Assets/PressStart2P.ttf");
+    font.loadFromMemory(EmbeddedAssets::Font.data, EmbeddedAssets::Font.size);
     start_text.setFont(font);
     start_text.setString("Start");
     start_text.setCharacterSize(24);
@@ -309,26 +369,16 @@ void Map::drawMenu(sf::RenderWindow &window)
     algorithm_text.setCharacterSize(28);
     algorithm_text.setFillColor(sf::Color::White);
 
-    if (alg_type == AlgorithmType::BFS)
-    {
-        algorithm_text.setString("BFS");
-        algorithm_text.setPosition(200, GRID_ROWS * NODE_SIZE_Y + 110);
-    }
-    else if (alg_type == AlgorithmType::DFS)
-    {
-        algorithm_text.setString("DFS");
-        algorithm_text.setPosition(200, GRID_ROWS * NODE_SIZE_Y + 110);
-    }
-    else if (alg_type == AlgorithmType::Dijkstra)
-    {
-        algorithm_text.setString("Dijkstra");
-        algorithm_text.setPosition(145, GRID_ROWS * NODE_SIZE_Y + 110);
-    }
-    else if (alg_type == AlgorithmType::Astar)
-    {
-        algorithm_text.setString("A*");
-        algorithm_text.setPosition(220, GRID_ROWS * NODE_SIZE_Y + 110);
-    }
+    style_text.setFont(font);
+    style_text.setCharacterSize(16);
+    style_text.setFillColor(sf::Color::White);
+    style_text.setPosition(470, GRID_ROWS * NODE_SIZE_Y + 40);
+
+    generate_text.setFont(font);
+    generate_text.setString("Generate");
+    generate_text.setCharacterSize(16);
+    generate_text.setFillColor(sf::Color(0x4F, 0xC3, 0xF7));
+    generate_text.setPosition(470, GRID_ROWS * NODE_SIZE_Y + 130);
 
     button1.setPointCount(3);
     button1.setPoint(0, sf::Vector2f(108, GRID_ROWS * NODE_SIZE_Y + 100));
@@ -341,6 +391,62 @@ void Map::drawMenu(sf::RenderWindow &window)
     button2.setPoint(1, sf::Vector2f(403, GRID_ROWS * NODE_SIZE_Y + 116));
     button2.setPoint(2, sf::Vector2f(395, GRID_ROWS * NODE_SIZE_Y + 132));
     button2.setFillColor(sf::Color::White);
+}
+
+void Map::drawMenu(sf::RenderWindow &window)
+{
+    // Only the icon sheet and the algorithm name follow the editor state
+    if (menuStale || menuStartSearch != startSearch)
+    {
+        // Tools are greyed out during a search, the mini-dungeon only becomes available after it
+        TextureManager::Sheet tools = startSearch ? TextureManager::Sheet::NoIcons : TextureManager::Sheet::Icons;
+        TextureManager::Sheet dungeon = startSearch ? TextureManager::Sheet::Icons : TextureManager::Sheet::NoIcons;
+
+        pencil_sprite.setTextureRect(txtManager.rect(tools, 0, 0, 24, 24));
+        erase_sprite.setTextureRect(txtManager.rect(tools, 26, 0, 24, 24));
+        end_flag_sprite.setTextureRect(txtManager.rect(tools, 0, 26, 24, 24));
+        start_flag_sprite.setTextureRect(txtManager.rect(tools, 26, 26, 24, 24));
+        dungeon_sprite.setTextureRect(txtManager.rect(dungeon, 0, 52, 24, 24));
+        menuStartSearch = startSearch;
+    }
+
+    if (menuStale || menuAlgorithm != alg_type)
+    {
+        if (alg_type == AlgorithmType::BFS)
+        {
+            algorithm_text.setString("BFS");
+            algorithm_text.setPosition(200, GRID_ROWS * NODE_SIZE_Y + 110);
+        }
+        else if (alg_type == AlgorithmType::DFS)
+        {
+            algorithm_text.setString("DFS");
+            algorithm_text.setPosition(200, GRID_ROWS * NODE_SIZE_Y + 110);
+        }
+        else if (alg_type == AlgorithmType::Dijkstra)
+        {
+            algorithm_text.setString("Dijkstra");
+            algorithm_text.setPosition(145, GRID_ROWS * NODE_SIZE_Y + 110);
+        }
+        else if (alg_type == AlgorithmType::Astar)
+        {
+            algorithm_text.setString("A*");
+            algorithm_text.setPosition(220, GRID_ROWS * NODE_SIZE_Y + 110);
+        }
+        else if (alg_type == AlgorithmType::Subgoal)
+        {
+            algorithm_text.setString("Subgoal");
+            algorithm_text.setPosition(160, GRID_ROWS * NODE_SIZE_Y + 110);
+        }
+        menuAlgorithm = alg_type;
+    }
+
+    if (menuStale || menuStyle != map_style)
+    {
+        style_text.setString(mapStyleName(map_style));
+        menuStyle = map_style;
+    }
+
+    menuStale = false;
 
     window.draw(menu);
     window.draw(pencil_sprite);
@@ -354,6 +460,8 @@ void Map::drawMenu(sf::RenderWindow &window)
     window.draw(algorithm_text);
     window.draw(button1);
     window.draw(button2);
+    window.draw(style_text);
+    window.draw(generate_text);
 
     if (!startSearch)
         window.draw(cursor_sprite);
@@ -367,37 +475,37 @@ void Map::dungeonMap(sf::RenderWindow &window, std::vector<std::vector<Node>> &g
         {
             Node &node = grid[y][x];
 
-            node.nodeSprite.setTexture(txtManager.dungeon_texture);
+            node.nodeSprite.setTexture(txtManager.atlas);
 
             switch (node.type)
             {
             case Node::NodeType::Empty:
-                node.nodeSprite.setTextureRect(sf::IntRect(12, 1, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 12, 1, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
                 break;
             case Node::NodeType::Wall:
-                node.nodeSprite.setTextureRect(sf::IntRect(1, 1, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 1, 1, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
                 break;
             case Node::NodeType::Start:
-                node.nodeSprite.setTextureRect(sf::IntRect(23, 23, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 23, 23, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
                 break;
             case Node::NodeType::End:
-                node.nodeSprite.setTextureRect(sf::IntRect(12, 23, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 12, 23, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
                 break;
             case Node::NodeType::Visited:
-                node.nodeSprite.setTextureRect(sf::IntRect(12, 1, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 12, 1, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
                 break;
             case Node::NodeType::Path:
-                node.nodeSprite.setTextureRect(sf::IntRect(34, 1, 10, 10));
+                node.nodeSprite.setTextureRect(txtManager.rect(TextureManager::Sheet::Dungeon, 34, 1, 10, 10));
                 node.nodeSprite.setScale(2.0f, 2.0f);
                 node.nodeSprite.setPosition(x * NODE_SIZE_X, y * NODE_SIZE_Y);
             }
@@ -407,54 +515,44 @@ void Map::dungeonMap(sf::RenderWindow &window, std::vector<std::vector<Node>> &g
     }
 }
 
-void Map::moveCharacter(std::vector<std::vector<Node>> &grid)
+// Move the character one node along the path, returns false once it has arrived
+// It only steps onto nodes the replay has already shown as path
+bool Map::moveCharacter(std::vector<std::vector<Node>> &grid)
 {
-    Node *startNode = nullptr;
-
-    // Find the starting node
-    for (int y = 0; y < GRID_ROWS; ++y)
+    if (characterPath.empty())
     {
-        for (int x = 0; x < GRID_COLS; ++x)
+        for (uint32_t entry : searchTrace.events)
         {
-            if (grid[y][x].type == Node::NodeType::Start)
+            if (SearchTrace::eventOf(entry) == SearchTrace::Event::Path)
             {
-                startNode = &grid[y][x];
-                break;
+                int id = SearchTrace::cellOf(entry);
+                characterPath.push_back(id / searchTrace.cols, id % searchTrace.cols);
             }
         }
-        if (startNode)
-        {
-            break;
-        }
+        characterStep = characterPath.begin();
     }
 
-    int startRow = startNode->shape.getPosition().y / NODE_SIZE_Y;
-    int startCol = startNode->shape.getPosition().x / NODE_SIZE_X;
-
-    // Find the next node of Path type with the same row and column as the starting node
-    Node *nextPathNode = nullptr;
+    if (characterStep == characterPath.end())
+    {
+        return false;
+    }
 
-    for (int y = 0; y < GRID_ROWS; ++y)
+    CompactPath::Iterator next = characterStep;
+    if (++next == characterPath.end())
     {
-        for (int x = 0; x < GRID_COLS; ++x)
-        {
-            if (grid[y][x].type == Node::NodeType::Path && grid[y][x].parent == std::make_pair(startRow, startCol))
-            {
-                nextPathNode = &grid[y][x];
-                break;
-            }
-        }
-        if (nextPathNode)
-        {
-            break;
-        }
+        return false;
     }
 
-    if (nextPathNode)
+    Node &current = grid[characterStep->first][characterStep->second];
+    Node &nextNode = grid[next->first][next->second];
+    if (current.type != Node::NodeType::Start || nextNode.type != Node::NodeType::Path)
     {
-        // Change the starting node to the next Path node
-        startNode->type = Node::NodeType::Visited;
-        nextPathNode->type = Node::NodeType::Start;
-        sf::sleep(sf::milliseconds(200)); // Introduce a delay for visualization
+        return false;
     }
+
+    // Change the starting node to the next Path node
+    current.type = Node::NodeType::Visited;
+    nextNode.type = Node::NodeType::Start;
+    characterStep = next;
+    return true;
 }
\ No newline at end of file
@@ -4,6 +4,12 @@
 #include <cmath>
 #include <SFML/Graphics.hpp>
 #include "TextureManager.h"
+#include "Clearance.h"
+#include "SearchTrace.h"
+#include "CompactPath.h"
+#include "MapGenerator.h"
+#include "SubgoalGraph.h"
+#include "LearnedHeuristic.h"
 
 struct Node
 {
@@ -19,6 +25,7 @@ struct Node
 
     std::pair<int, int> parent; // Parent coordinates
     NodeType type;
+    int clearance = 1; // Largest free square with this node as top-left corner, see Clearance.h
     sf::RectangleShape shape;
     sf::Sprite nodeSprite;
 
@@ -29,7 +36,7 @@ class Map
 {
 public:
     Map(int rows, int cols, int nodeSizeX, int nodeSizeY) :
-        GRID_ROWS(rows), GRID_COLS(cols), NODE_SIZE_X(nodeSizeX), NODE_SIZE_Y(nodeSizeY),
+        learnedHeuristic(rows, cols), GRID_ROWS(rows), GRID_COLS(cols), NODE_SIZE_X(nodeSizeX), NODE_SIZE_Y(nodeSizeY),
         WINDOW_WIDTH(GRID_COLS * NODE_SIZE_X), WINDOW_HEIGHT(GRID_ROWS * NODE_SIZE_Y + 180) {
 
         // Initialize the grid of nodes
@@ -52,17 +59,37 @@ public:
                 node.shape.setOutlineColor(GRID_COLOR);
             }
         }
+
+        computeClearance(grid);
+        subgoalGraph.build();
+        initMenu();
     }
 
     TextureManager txtManager;
 
+    // Events of the last search, replayed on the grid a few at a time
+    SearchTrace searchTrace;
+    int replaySpeed = 20; // Events per frame
+
     // 2D vector to hold grid nodes
     std::vector<std::vector<Node>> grid;
+
+    // Convex corners of the walls and the direct paths between them, kept up to date with the walls
+    SubgoalGraph subgoalGraph{grid};
+
+    // What real-time agents (see RealTimeSearch.h) learned on this map, saved and loaded with it
+    // and forgotten when a wall is erased, since the values could then overestimate
+    LearnedHeuristic learnedHeuristic;
     sf::RectangleShape menu;
 
     sf::ConvexShape button1;
     sf::ConvexShape button2;
 
+    // Clicking the style cycles through the generators, Generate makes a new map of that style
+    sf::Text style_text;
+    sf::Text generate_text;
+    MapStyle map_style = MapStyle::Maze;
+
     void drawMenu(sf::RenderWindow &window);
     void drawNodes(sf::RenderWindow &window, std::vector<std::vector<Node>> &grid);
     void drawGrid(sf::RenderWindow &window);
@@ -71,9 +98,15 @@ public:
     bool hasEndNode();
     void updateTools(sf::RenderWindow &window);
     void emptyMap(std::vector<std::vector<Node>> &grid);
+    void clearMap(std::vector<std::vector<Node>> &grid);
+    bool saveMap(const std::string &path);
+    bool loadMap(const std::string &path);
+    void generate();
+    void resetTrace();
+    bool replayTrace();
 
     void dungeonMap(sf::RenderWindow &window, std::vector<std::vector<Node>> &grid);
-    void moveCharacter(std::vector<std::vector<Node>> &grid);
+    bool moveCharacter(std::vector<std::vector<Node>> &grid);
 
     int getWindowWidth(){
         return WINDOW_WIDTH;
@@ -107,12 +140,17 @@ public:
         return startMiniDungeon;
     }
 
+    const sf::Font &getFont(){
+        return font;
+    }
+
     enum class AlgorithmType
     {
         BFS,
         DFS,
         Dijkstra,
-        Astar
+        Astar,
+        Subgoal
     };
 
     AlgorithmType alg_type;
@@ -150,6 +188,22 @@ private:
 
     bool startMiniDungeon = false;
 
+    // Menu state the sprites and texts were last set up for, see drawMenu
+    void initMenu();
+    bool menuStale = true;
+    bool menuStartSearch = false;
+    AlgorithmType menuAlgorithm = AlgorithmType::BFS;
+    MapStyle menuStyle = MapStyle::Maze;
+
+    // Seed of the next generated map, printed so a map can be generated again
+    uint64_t mapSeed = 1;
+
+    size_t traceCursor = 0;
+
+    // Path walked by the mini-dungeon character, read from the trace on its first step
+    CompactPath characterPath;
+    CompactPath::Iterator characterStep = characterPath.begin();
+
     enum class ToolType
     {
         Pencil,
@@ -0,0 +1,328 @@
+#include "MapFile.h"
+#include "Map.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char MAGIC[4] = {'P', 'F', 'M', 'P'};
+
+    size_t align8(size_t size)
+    {
+        return (size + 7) & ~size_t(7);
+    }
+
+    size_t wordCount(size_t cells)
+    {
+        return (cells + 63) / 64;
+    }
+
+    void writeVarint(std::vector<uint8_t> &out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(uint8_t(value) | 0x80);
+            value >>= 7;
+        }
+        out.push_back(uint8_t(value));
+    }
+
+    bool readVarint(const uint8_t *&data, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && data < end; shift += 7)
+        {
+            uint8_t byte = *data++;
+            value |= uint64_t(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    // Set the bits of cells [from, to)
+    void setBits(std::vector<uint64_t> &words, size_t from, size_t to)
+    {
+        while (from < to)
+        {
+            size_t word = from >> 6;
+            size_t first = from & 63;
+            size_t last = std::min<size_t>(64, first + (to - from));
+            uint64_t mask = (last == 64 ? ~uint64_t(0) : (uint64_t(1) << last) - 1) & ~((uint64_t(1) << first) - 1);
+            words[word] |= mask;
+            from += last - first;
+        }
+    }
+}
+
+bool MapFile::open(const std::string &path)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || size_t(info.st_size) < sizeof(Header))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mapping = data;
+    mappingSize = info.st_size;
+
+    const uint8_t *base = static_cast<const uint8_t *>(data);
+    header = reinterpret_cast<const Header *>(base);
+
+    if (std::memcmp(header->magic, MAGIC, 4) != 0 || header->version != VERSION)
+    {
+        close();
+        return false;
+    }
+
+    // Checked before anything is allocated, a corrupt header must not ask for gigabytes
+    uint64_t cells = uint64_t(header->rows) * header->cols;
+    if (header->rows > INT_MAX || header->cols > INT_MAX || cells > MAX_CELLS)
+    {
+        close();
+        return false;
+    }
+    size_t offset = sizeof(Header);
+
+    // Next section of the file, nullptr if the file is too short for it
+    auto section = [&](size_t size) -> const uint8_t *
+    {
+        if (size > mappingSize - std::min(offset, mappingSize))
+            return nullptr;
+
+        const uint8_t *start = base + offset;
+        offset = std::min(mappingSize, offset + align8(size));
+        return start;
+    };
+
+    const uint8_t *wallData = section(header->wallBytes);
+    if (!wallData)
+    {
+        close();
+        return false;
+    }
+
+    if (header->flags & WallsRLE)
+    {
+        decodedWalls.assign(wordCount(cells), 0);
+
+        const uint8_t *end = wallData + header->wallBytes;
+        size_t cell = 0;
+        bool wall = false;
+        while (wallData < end)
+        {
+            uint64_t run;
+            if (!readVarint(wallData, end, run) || run > cells - cell)
+            {
+                close();
+                return false;
+            }
+            if (wall)
+                setBits(decodedWalls, cell, cell + run);
+
+            cell += run;
+            wall = !wall;
+        }
+
+        if (cell != cells)
+        {
+            close();
+            return false;
+        }
+        walls = decodedWalls.data();
+    }
+    else
+    {
+        if (header->wallBytes != wordCount(cells) * sizeof(uint64_t))
+        {
+            close();
+            return false;
+        }
+        walls = reinterpret_cast<const uint64_t *>(wallData);
+    }
+
+    if (header->flags & HasCosts)
+    {
+        costs = section(cells);
+    }
+    startCells = reinterpret_cast<const Cell *>(section(size_t(header->startCount) * sizeof(Cell)));
+    goalCells = reinterpret_cast<const Cell *>(section(size_t(header->goalCount) * sizeof(Cell)));
+
+    if (((header->flags & HasCosts) && !costs) || !startCells || !goalCells)
+    {
+        close();
+        return false;
+    }
+
+    for (int i = 0; i < startCount() + goalCount(); ++i)
+    {
+        const Cell &cell = i < startCount() ? startCells[i] : goalCells[i - startCount()];
+        if (cell.row >= header->rows || cell.col >= header->cols)
+        {
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void MapFile::close()
+{
+    if (mapping)
+    {
+        munmap(mapping, mappingSize);
+    }
+
+    mapping = nullptr;
+    mappingSize = 0;
+    header = nullptr;
+    walls = nullptr;
+    costs = nullptr;
+    startCells = nullptr;
+    goalCells = nullptr;
+    decodedWalls.clear();
+}
+
+void MapFile::toGrid(std::vector<std::vector<Node>> &grid) const
+{
+    // Only the part both grids have in common is copied
+    int copyRows = std::min<int>(rows(), grid.size());
+    int copyCols = grid.empty() ? 0 : std::min<int>(cols(), grid[0].size());
+
+    for (int row = 0; row < copyRows; ++row)
+    {
+        for (int col = 0; col < copyCols; ++col)
+        {
+            grid[row][col].type = isWall(row, col) ? Node::NodeType::Wall : Node::NodeType::Empty;
+        }
+    }
+
+    for (int i = 0; i < startCount(); ++i)
+    {
+        if (int(startCells[i].row) < copyRows && int(startCells[i].col) < copyCols)
+            grid[startCells[i].row][startCells[i].col].type = Node::NodeType::Start;
+    }
+
+    for (int i = 0; i < goalCount(); ++i)
+    {
+        if (int(goalCells[i].row) < copyRows && int(goalCells[i].col) < copyCols)
+            grid[goalCells[i].row][goalCells[i].col].type = Node::NodeType::End;
+    }
+}
+
+bool MapFile::save(const std::string &path, const std::vector<std::vector<Node>> &grid, const std::vector<uint8_t> *costs)
+{
+    Header header = {};
+    std::memcpy(header.magic, MAGIC, 4);
+    header.version = VERSION;
+    header.rows = grid.size();
+    header.cols = grid.empty() ? 0 : grid[0].size();
+
+    size_t cells = size_t(header.rows) * header.cols;
+    if (costs && costs->size() != cells)
+    {
+        return false;
+    }
+
+    std::vector<uint64_t> bits(wordCount(cells), 0);
+    std::vector<Cell> starts;
+    std::vector<Cell> goals;
+
+    for (uint32_t row = 0; row < header.rows; ++row)
+    {
+        for (uint32_t col = 0; col < header.cols; ++col)
+        {
+            size_t cell = size_t(row) * header.cols + col;
+            switch (grid[row][col].type)
+            {
+            case Node::NodeType::Wall:
+                bits[cell >> 6] |= uint64_t(1) << (cell & 63);
+                break;
+            case Node::NodeType::Start:
+                starts.push_back({row, col});
+                break;
+            case Node::NodeType::End:
+                goals.push_back({row, col});
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    // Runs of equal cells, starting with an empty run that may be zero long
+    std::vector<uint8_t> runs;
+    bool wall = false;
+    size_t runStart = 0;
+    for (size_t cell = 0; cell <= cells; ++cell)
+    {
+        bool isWall = cell < cells && ((bits[cell >> 6] >> (cell & 63)) & 1);
+        if (cell == cells || isWall != wall)
+        {
+            writeVarint(runs, cell - runStart);
+            runStart = cell;
+            wall = !wall;
+        }
+    }
+
+    bool compress = runs.size() < bits.size() * sizeof(uint64_t);
+    header.flags = (compress ? WallsRLE : 0) | (costs ? HasCosts : 0);
+    header.wallBytes = compress ? runs.size() : bits.size() * sizeof(uint64_t);
+    header.startCount = starts.size();
+    header.goalCount = goals.size();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    const char padding[8] = {};
+    auto write = [&](const void *data, size_t size)
+    {
+        file.write(static_cast<const char *>(data), size);
+        file.write(padding, align8(size) - size);
+    };
+
+    write(&header, sizeof(header));
+    if (compress)
+        write(runs.data(), runs.size());
+    else
+        write(bits.data(), bits.size() * sizeof(uint64_t));
+    if (costs)
+        write(costs->data(), costs->size());
+    write(starts.data(), starts.size() * sizeof(Cell));
+    write(goals.data(), goals.size() * sizeof(Cell));
+
+    return bool(file);
+}
+
+bool MapFile::isMapFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[4] = {};
+    file.read(magic, 4);
+    return file && std::memcmp(magic, MAGIC, 4) == 0;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include <string>
+#include <vector>
+
+struct Node;
+
+// Versioned binary map format (.pfm), little-endian, every section aligned to 8 bytes
+//
+//   Header    magic "PFMP", version, flags, rows, cols, start and goal counts, wall section size
+//   Walls     one bit per cell in row-major order, 64 cells per word, bit i of word w is cell 64 * w + i
+//             or, with the RLE flag, alternating empty and wall run lengths as LEB128 varints,
+//             starting with an empty run; the writer picks whichever is smaller
+//   Costs     one byte per cell, only with the costs flag
+//   Starts    (row, col) pairs as uint32
+//   Goals     (row, col) pairs as uint32
+//
+// Reading maps the file into memory: uncompressed wall bits and costs are used in place,
+// only RLE walls are expanded into a bitset
+class MapFile
+{
+public:
+    static const uint32_t VERSION = 1;
+
+    // Largest map open() accepts: the decoded walls stay under 32 MB, and the cell ids of every
+    // GridLayout, even padded to powers of two, fit in an int
+    static const uint64_t MAX_CELLS = uint64_t(1) << 28;
+
+    enum Flags : uint16_t
+    {
+        HasCosts = 1,
+        WallsRLE = 2
+    };
+
+    struct Header
+    {
+        char magic[4];
+        uint16_t version;
+        uint16_t flags;
+        uint32_t rows;
+        uint32_t cols;
+        uint32_t startCount;
+        uint32_t goalCount;
+        uint64_t wallBytes; // Size of the wall section before padding
+    };
+
+    struct Cell
+    {
+        uint32_t row;
+        uint32_t col;
+    };
+
+    MapFile() {}
+    ~MapFile() { close(); }
+
+    MapFile(const MapFile &) = delete;
+    MapFile &operator=(const MapFile &) = delete;
+
+    // Map a file and check its header and section sizes, false if it is not a valid map
+    bool open(const std::string &path);
+    void close();
+
+    int rows() const { return header && header->rows <= INT_MAX ? header->rows : 0; }
+    int cols() const { return header && header->cols <= INT_MAX ? header->cols : 0; }
+
+    bool isWall(int row, int col) const
+    {
+        size_t cell = size_t(row) * header->cols + col;
+        return (walls[cell >> 6] >> (cell & 63)) & 1;
+    }
+
+    // Wall bitset, pointing into the mapping unless the file was compressed
+    const uint64_t *wallWords() const { return walls; }
+
+    bool hasCosts() const { return costs != nullptr; }
+    uint8_t cost(int row, int col) const { return costs[size_t(row) * header->cols + col]; }
+
+    const Cell *starts() const { return startCells; }
+    const Cell *goals() const { return goalCells; }
+    int startCount() const { return header ? header->startCount : 0; }
+    int goalCount() const { return header ? header->goalCount : 0; }
+
+    // Copy walls, starts and goals into an editor or service grid of the same size
+    void toGrid(std::vector<std::vector<Node>> &grid) const;
+
+    // Write a grid, with an optional cost layer of rows * cols bytes
+    static bool save(const std::string &path, const std::vector<std::vector<Node>> &grid,
+                     const std::vector<uint8_t> *costs = nullptr);
+
+    // True if the file starts with the map magic, to tell it apart from text maps
+    static bool isMapFile(const std::string &path);
+
+private:
+    void *mapping = nullptr;
+    size_t mappingSize = 0;
+
+    const Header *header = nullptr;
+    const uint64_t *walls = nullptr;
+    const uint8_t *costs = nullptr;
+    const Cell *startCells = nullptr;
+    const Cell *goalCells = nullptr;
+
+    std::vector<uint64_t> decodedWalls; // Only used for RLE files
+};
\ No newline at end of file
@@ -0,0 +1,307 @@
+#include "MapGenerator.h"
+#include "Map.h"
+#include <algorithm>
+
+namespace
+{
+    typedef std::vector<std::vector<Node>> Grid;
+
+    void fill(Grid &grid, Node::NodeType type)
+    {
+        for (auto &row : grid)
+        {
+            for (auto &node : row)
+            {
+                node.type = type;
+            }
+        }
+    }
+
+    void fillRect(Grid &grid, int top, int left, int bottom, int right, Node::NodeType type)
+    {
+        for (int row = std::max(top, 0); row <= std::min<int>(bottom, grid.size() - 1); ++row)
+        {
+            for (int col = std::max(left, 0); col <= std::min<int>(right, grid[0].size() - 1); ++col)
+            {
+                grid[row][col].type = type;
+            }
+        }
+    }
+
+    // Recursive backtracker on the nodes with odd coordinates, the ones in between become walls
+    // or corridors; an explicit stack keeps it safe on very large grids
+    void maze(Grid &grid, MapRandom &random)
+    {
+        fill(grid, Node::NodeType::Wall);
+
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+        const int dRow[] = {-2, 2, 0, 0};
+        const int dCol[] = {0, 0, -2, 2};
+
+        std::vector<std::pair<int, int>> stack;
+        stack.push_back({1 % rows, 1 % cols});
+        grid[stack.back().first][stack.back().second].type = Node::NodeType::Empty;
+
+        while (!stack.empty())
+        {
+            auto [row, col] = stack.back();
+
+            int options[4];
+            int count = 0;
+            for (int d = 0; d < 4; ++d)
+            {
+                int nextRow = row + dRow[d];
+                int nextCol = col + dCol[d];
+                if (nextRow > 0 && nextRow < rows && nextCol > 0 && nextCol < cols &&
+                    grid[nextRow][nextCol].type == Node::NodeType::Wall)
+                {
+                    options[count++] = d;
+                }
+            }
+
+            if (count == 0)
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            int d = options[random.below(count)];
+            grid[row + dRow[d] / 2][col + dCol[d] / 2].type = Node::NodeType::Empty;
+            grid[row + dRow[d]][col + dCol[d]].type = Node::NodeType::Empty;
+            stack.push_back({row + dRow[d], col + dCol[d]});
+        }
+    }
+
+    void obstacles(Grid &grid, MapRandom &random, float density)
+    {
+        for (auto &row : grid)
+        {
+            for (auto &node : row)
+            {
+                node.type = random.unit() < density ? Node::NodeType::Wall : Node::NodeType::Empty;
+            }
+        }
+    }
+
+    // Rooms are placed at random where they touch nothing carved before, and every room is
+    // joined to the previous one by an L-shaped corridor
+    void rooms(Grid &grid, MapRandom &random)
+    {
+        fill(grid, Node::NodeType::Wall);
+
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+        const int maxSide = std::max(3, std::min(rows, cols) / 4);
+
+        struct Room
+        {
+            int top, left, bottom, right;
+        };
+        std::vector<Room> placed;
+
+        int attempts = std::max(8, rows * cols / 64);
+        for (int i = 0; i < attempts; ++i)
+        {
+            int height = random.between(3, std::min(maxSide, 12));
+            int width = random.between(3, std::min(maxSide, 16));
+            if (height > rows - 2 || width > cols - 2)
+                continue;
+
+            Room room;
+            room.top = random.between(1, rows - 1 - height);
+            room.left = random.between(1, cols - 1 - width);
+            room.bottom = room.top + height - 1;
+            room.right = room.left + width - 1;
+
+            // Rooms and corridors already carved are kept one node away
+            bool overlaps = false;
+            for (int row = room.top - 1; row <= room.bottom + 1 && !overlaps; ++row)
+            {
+                for (int col = room.left - 1; col <= room.right + 1; ++col)
+                {
+                    if (grid[row][col].type != Node::NodeType::Wall)
+                    {
+                        overlaps = true;
+                        break;
+                    }
+                }
+            }
+            if (overlaps)
+                continue;
+
+            fillRect(grid, room.top, room.left, room.bottom, room.right, Node::NodeType::Empty);
+
+            if (!placed.empty())
+            {
+                const Room &previous = placed.back();
+                int fromRow = (previous.top + previous.bottom) / 2;
+                int fromCol = (previous.left + previous.right) / 2;
+                int toRow = (room.top + room.bottom) / 2;
+                int toCol = (room.left + room.right) / 2;
+
+                if (random.below(2))
+                {
+                    fillRect(grid, fromRow, std::min(fromCol, toCol), fromRow, std::max(fromCol, toCol), Node::NodeType::Empty);
+                    fillRect(grid, std::min(fromRow, toRow), toCol, std::max(fromRow, toRow), toCol, Node::NodeType::Empty);
+                }
+                else
+                {
+                    fillRect(grid, std::min(fromRow, toRow), fromCol, std::max(fromRow, toRow), fromCol, Node::NodeType::Empty);
+                    fillRect(grid, toRow, std::min(fromCol, toCol), toRow, std::max(fromCol, toCol), Node::NodeType::Empty);
+                }
+            }
+
+            placed.push_back(room);
+        }
+    }
+
+    void openField(Grid &grid, MapRandom &random)
+    {
+        fill(grid, Node::NodeType::Empty);
+
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+
+        int blocks = std::max(1, rows * cols / 400);
+        for (int i = 0; i < blocks; ++i)
+        {
+            int top = random.below(rows);
+            int left = random.below(cols);
+            fillRect(grid, top, left, top + random.between(0, 3), left + random.between(0, 3), Node::NodeType::Wall);
+        }
+    }
+
+    // Label the 4-connected areas of free nodes and return the label of the largest one, so the
+    // Start and End can be put where a path joins them (-1 if every node is a wall)
+    int largestArea(const Grid &grid, std::vector<int> &area)
+    {
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+        const int dRow[] = {-1, 1, 0, 0};
+        const int dCol[] = {0, 0, -1, 1};
+
+        area.assign(rows * cols, -1);
+        int largest = -1;
+        size_t largestSize = 0;
+        int label = 0;
+        std::vector<int> stack;
+
+        for (int id = 0; id < rows * cols; ++id)
+        {
+            if (area[id] >= 0 || grid[id / cols][id % cols].type == Node::NodeType::Wall)
+                continue;
+
+            size_t size = 0;
+            area[id] = label;
+            stack.push_back(id);
+            while (!stack.empty())
+            {
+                int current = stack.back();
+                stack.pop_back();
+                ++size;
+
+                for (int d = 0; d < 4; ++d)
+                {
+                    int row = current / cols + dRow[d];
+                    int col = current % cols + dCol[d];
+                    if (row < 0 || row >= rows || col < 0 || col >= cols || area[row * cols + col] >= 0 ||
+                        grid[row][col].type == Node::NodeType::Wall)
+                        continue;
+
+                    area[row * cols + col] = label;
+                    stack.push_back(row * cols + col);
+                }
+            }
+
+            if (size > largestSize)
+            {
+                largest = label;
+                largestSize = size;
+            }
+            ++label;
+        }
+        return largest;
+    }
+
+    // First free node of the given area in diagonal order from the given corner
+    void placeFlag(Grid &grid, bool fromTopLeft, Node::NodeType type, const std::vector<int> &area, int label)
+    {
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+
+        for (int diagonal = 0; diagonal < rows + cols - 1; ++diagonal)
+        {
+            for (int i = 0; i <= diagonal; ++i)
+            {
+                int row = i;
+                int col = diagonal - i;
+                if (row >= rows || col >= cols)
+                    continue;
+
+                if (!fromTopLeft)
+                {
+                    row = rows - 1 - row;
+                    col = cols - 1 - col;
+                }
+
+                if (grid[row][col].type == Node::NodeType::Empty && area[row * cols + col] == label)
+                {
+                    grid[row][col].type = type;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+const char *mapStyleName(MapStyle style)
+{
+    switch (style)
+    {
+    case MapStyle::Maze:
+        return "Maze";
+    case MapStyle::Obstacles:
+        return "Obstacles";
+    case MapStyle::Rooms:
+        return "Rooms";
+    case MapStyle::OpenField:
+        return "Open field";
+    }
+    return "";
+}
+
+void generateMap(std::vector<std::vector<Node>> &grid, MapStyle style, uint64_t seed, float density)
+{
+    if (grid.empty() || grid[0].empty())
+    {
+        return;
+    }
+
+    MapRandom random(seed);
+
+    switch (style)
+    {
+    case MapStyle::Maze:
+        maze(grid, random);
+        break;
+    case MapStyle::Obstacles:
+        obstacles(grid, random, density);
+        break;
+    case MapStyle::Rooms:
+        rooms(grid, random);
+        break;
+    case MapStyle::OpenField:
+        openField(grid, random);
+        break;
+    }
+
+    // Random obstacles and open field blocks can cut the map apart, both flags go in the largest
+    // area so the End is always reachable from the Start
+    std::vector<int> area;
+    int label = largestArea(grid, area);
+    placeFlag(grid, true, Node::NodeType::Start, area, label);
+    placeFlag(grid, false, Node::NodeType::End, area, label);
+
+    computeClearance(grid);
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+struct Node;
+
+// Seeded map generators, the same seed and size always give the same map on every platform
+// They fill the whole grid, put a Start node near the top-left corner and an End node near
+// the bottom-right corner, both in the largest connected free area, and recompute the clearance layer
+enum class MapStyle
+{
+    Maze,      // Perfect maze, corridors one node wide
+    Obstacles, // Every node is a wall with the given probability
+    Rooms,     // Rectangular rooms joined by corridors
+    OpenField  // Mostly empty with a few small blocks
+};
+
+const int MAP_STYLE_COUNT = 4;
+
+const char *mapStyleName(MapStyle style);
+
+// density is only used by MapStyle::Obstacles
+void generateMap(std::vector<std::vector<Node>> &grid, MapStyle style, uint64_t seed, float density = 0.3f);
+
+// SplitMix64, small and fast, and unlike the standard distributions its output is fully specified
+class MapRandom
+{
+public:
+    explicit MapRandom(uint64_t seed) : state(seed) {}
+
+    uint64_t next()
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, bound)
+    int below(int bound)
+    {
+        return int((next() >> 32) * uint64_t(bound) >> 32);
+    }
+
+    // Uniform in [low, high]
+    int between(int low, int high)
+    {
+        return low + below(high - low + 1);
+    }
+
+    // Uniform in [0, 1)
+    float unit()
+    {
+        return (next() >> 40) * (1.0f / (1 << 24));
+    }
+
+private:
+    uint64_t state;
+};
\ No newline at end of file
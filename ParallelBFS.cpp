@@ -0,0 +1,267 @@
+#include "Pathfinder.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory_resource>
+
+namespace
+{
+    // Reusable barrier so the worker threads live for the whole search instead of one level
+    class LevelBarrier
+    {
+    public:
+        explicit LevelBarrier(int count) : count(count) {}
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            int currentGeneration = generation;
+            if (++arrived == count)
+            {
+                arrived = 0;
+                ++generation;
+                condition.notify_all();
+                return;
+            }
+            condition.wait(lock, [&] { return generation != currentGeneration; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        int count;
+        int arrived = 0;
+        int generation = 0;
+    };
+
+    // Direction-optimizing thresholds (Beamer et al.): go bottom-up when the frontier
+    // gets larger than the unexplored part / ALPHA, back to top-down below cells / BETA
+    const int ALPHA = 14;
+    const int BETA = 24;
+}
+
+void ParallelBFS::searchPath()
+{
+    if (startRow < 0 || endNodes.empty())
+    {
+        return;
+    }
+
+    const int cellCount = rows * cols;
+    const int threads = threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+
+    // The arrays come from the calling thread's arena, allocated here and by thread 0 only since
+    // an arena serves one thread at a time; the workers only read and write their contents
+    SearchArena::Scope arena;
+    std::pmr::memory_resource *resource = arena.resource();
+
+    std::pmr::vector<char> walkable(cellCount, resource);
+    std::pmr::vector<char> isGoal(cellCount, resource);
+    std::pmr::vector<char> inFrontier(cellCount, 0, resource);
+    std::pmr::vector<std::atomic<int>> claimedBy(cellCount, resource);
+    distances.assign(cellCount, -1);
+
+    std::pmr::vector<int> frontier(resource);
+
+    // Each worker grows its own buffer concurrently, which an arena can't serve, so these stay on
+    // the heap; they keep their capacity from one level to the next and only allocate while growing
+    std::vector<std::vector<int>> localNext(threads);
+
+    const int startId = startRow * cols + startCol;
+    std::atomic<int> foundGoal(INT_MAX);
+
+    int walkableCount = 0;
+    int visitedCount = 1;
+    int level = 0;
+    bool bottomUp = false;
+    bool done = false;
+
+    LevelBarrier barrier(threads);
+
+    // Claim a cell for the next level; records the smallest goal id reached so the result is deterministic
+    auto claim = [&](int id, std::vector<int> &next)
+    {
+        distances[id] = level + 1;
+        next.push_back(id);
+        if (isGoal[id])
+        {
+            int current = foundGoal.load(std::memory_order_relaxed);
+            while (id < current && !foundGoal.compare_exchange_weak(current, id, std::memory_order_relaxed))
+            {
+            }
+        }
+    };
+
+    auto worker = [&](int t)
+    {
+        // Copy the grid state into flat arrays, one band of rows per thread
+        for (int row = rows * t / threads; row < rows * (t + 1) / threads; ++row)
+        {
+            for (int col = 0; col < cols; ++col)
+            {
+                int id = row * cols + col;
+                walkable[id] = isWalkable(row, col);
+                isGoal[id] = 0;
+                claimedBy[id].store(-1, std::memory_order_relaxed);
+            }
+        }
+        barrier.wait();
+
+        if (t == 0)
+        {
+            for (const Position &end : endNodes)
+            {
+                isGoal[end.row * cols + end.col] = 1;
+            }
+            claimedBy[startId].store(startId, std::memory_order_relaxed);
+            distances[startId] = 0;
+            frontier.push_back(startId);
+            inFrontier[startId] = 1;
+            for (char w : walkable)
+            {
+                walkableCount += w;
+            }
+        }
+        barrier.wait();
+
+        while (!done)
+        {
+            std::vector<int> &next = localNext[t];
+            next.clear();
+
+            if (!bottomUp)
+            {
+                // Top-down: every frontier cell tries to claim its unvisited neighbors
+                int begin = frontier.size() * (long long)t / threads;
+                int end = frontier.size() * (long long)(t + 1) / threads;
+                for (int i = begin; i < end; ++i)
+                {
+                    int id = frontier[i];
+                    int row = id / cols;
+                    int col = id % cols;
+                    int adjacent[4] = {row > 0 ? id - cols : -1, row < rows - 1 ? id + cols : -1,
+                                       col > 0 ? id - 1 : -1, col < cols - 1 ? id + 1 : -1};
+                    for (int adjId : adjacent)
+                    {
+                        int unclaimed = -1;
+                        if (adjId >= 0 && walkable[adjId] && claimedBy[adjId].load(std::memory_order_relaxed) == -1 &&
+                            claimedBy[adjId].compare_exchange_strong(unclaimed, id, std::memory_order_relaxed))
+                        {
+                            claim(adjId, next);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // Bottom-up: every unvisited cell looks for a neighbor in the frontier, no atomics needed
+                // since each cell is only written by the thread that owns its range
+                int begin = cellCount * (long long)t / threads;
+                int end = cellCount * (long long)(t + 1) / threads;
+                for (int id = begin; id < end; ++id)
+                {
+                    if (!walkable[id] || claimedBy[id].load(std::memory_order_relaxed) != -1)
+                    {
+                        continue;
+                    }
+                    int row = id / cols;
+                    int col = id % cols;
+                    int adjacent[4] = {row > 0 ? id - cols : -1, row < rows - 1 ? id + cols : -1,
+                                       col > 0 ? id - 1 : -1, col < cols - 1 ? id + 1 : -1};
+                    for (int adjId : adjacent)
+                    {
+                        if (adjId >= 0 && inFrontier[adjId])
+                        {
+                            claimedBy[id].store(adjId, std::memory_order_relaxed);
+                            claim(id, next);
+                            break;
+                        }
+                    }
+                }
+            }
+            barrier.wait();
+
+            // Merge the per-thread buffers into the next frontier and pick the next direction
+            if (t == 0)
+            {
+                for (int id : frontier)
+                {
+                    inFrontier[id] = 0;
+                }
+                frontier.clear();
+                for (const std::vector<int> &buffer : localNext)
+                {
+                    frontier.insert(frontier.end(), buffer.begin(), buffer.end());
+                }
+                for (int id : frontier)
+                {
+                    inFrontier[id] = 1;
+                }
+
+                ++level;
+                visitedCount += frontier.size();
+
+                int unexplored = walkableCount - visitedCount;
+                if (!bottomUp && (long long)frontier.size() * ALPHA > unexplored)
+                {
+                    bottomUp = true;
+                }
+                else if (bottomUp && (long long)frontier.size() * BETA < cellCount)
+                {
+                    bottomUp = false;
+                }
+
+                done = frontier.empty() || foundGoal.load() != INT_MAX;
+            }
+            barrier.wait();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t)
+    {
+        workers.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread &thread : workers)
+    {
+        thread.join();
+    }
+
+    // Copy the parents into the array read by obtainPath
+    std::pmr::vector<int> parents(cellCount, resource);
+    for (int id = 0; id < cellCount; ++id)
+    {
+        parents[id] = claimedBy[id].load(std::memory_order_relaxed);
+    }
+
+    // Record the reached nodes level by level, so the replay shows the frontier growing
+    if (trace)
+    {
+        trace->cols = cols;
+        std::vector<std::vector<int>> levels(level + 1);
+        for (int id = 0; id < cellCount; ++id)
+        {
+            if (distances[id] >= 0)
+            {
+                levels[distances[id]].push_back(id);
+            }
+        }
+        for (const std::vector<int> &cells : levels)
+        {
+            for (int id : cells)
+            {
+                trace->record(SearchTrace::Event::Push, id);
+            }
+        }
+    }
+
+    int goal = foundGoal.load();
+    if (goal != INT_MAX)
+    {
+        endRow = goal / cols;
+        endCol = goal % cols;
+        obtainPath(parents);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "PathCache.h"
+#include "Bresenham.h"
+#include <algorithm>
+#include <cstdlib>
+
+const CompactPath *PathCache::find(const Key &key)
+{
+    auto found = index.find(key);
+    if (found == index.end())
+    {
+        ++misses;
+        return nullptr;
+    }
+
+    ++hits;
+    entries.splice(entries.begin(), entries, found->second);
+    return &found->second->path;
+}
+
+void PathCache::insert(const Key &key, const CompactPath &path, bool optimal)
+{
+    // Searches that found no path are not cached, any wall removal could change them
+    if (path.empty() || capacity <= 0)
+    {
+        return;
+    }
+
+    auto found = index.find(key);
+    if (found != index.end())
+    {
+        erase(found->second);
+    }
+    else if ((int)entries.size() >= capacity)
+    {
+        erase(std::prev(entries.end()));
+    }
+
+    int manhattan = std::abs(path.back().first - path.front().first) + std::abs(path.back().second - path.front().second);
+    entries.push_front(Entry{key, path, {}, optimal && int(path.size()) - 1 > manhattan});
+    Entry &entry = entries.front();
+    entry.path.shrink_to_fit();
+    pathBytes += entry.path.memoryUsage();
+    index[key] = entries.begin();
+
+    // Agents bigger than one node also cover the nodes below and to the right of their position
+    // Their footprint is never wider than a region, so its corners reach every region it covers
+    int extent = key.agentSize - 1;
+    auto addNode = [&](int row, int col)
+    {
+        for (long long region : {regionOf(row, col), regionOf(row + extent, col), regionOf(row, col + extent), regionOf(row + extent, col + extent)})
+        {
+            if (std::find(entry.regions.begin(), entry.regions.end(), region) == entry.regions.end())
+            {
+                entry.regions.push_back(region);
+                regionIndex[region].insert(key);
+            }
+        }
+    };
+
+    // Consecutive nodes can be turning points (ThetaStar), so walk every segment over the
+    // nodes Pathfinder::lineOfSight checks: the line and the corners of its diagonal steps
+    std::pair<int, int> from = path.front();
+    addNode(from.first, from.second);
+    for (const auto &to : path)
+    {
+        int previousRow = from.first;
+        int previousCol = from.second;
+        traceLine(previousCol, previousRow, to.second, to.first, [&](int col, int row)
+        {
+            if (row != previousRow && col != previousCol)
+            {
+                addNode(previousRow, col);
+                addNode(row, previousCol);
+            }
+            addNode(row, col);
+            previousRow = row;
+            previousCol = col;
+            return true;
+        });
+        from = to;
+    }
+}
+
+void PathCache::invalidate(int row, int col)
+{
+    auto found = regionIndex.find(regionOf(row, col));
+    if (found == regionIndex.end())
+    {
+        return;
+    }
+
+    // Copy the keys, erasing entries modifies the region index
+    std::vector<Key> keys(found->second.begin(), found->second.end());
+    for (const Key &key : keys)
+    {
+        erase(index[key]);
+        ++invalidations;
+    }
+}
+
+void PathCache::invalidateShortcuts()
+{
+    for (auto entry = entries.begin(); entry != entries.end();)
+    {
+        auto next = std::next(entry);
+        if (entry->improvable)
+        {
+            erase(entry);
+            ++invalidations;
+        }
+        entry = next;
+    }
+}
+
+void PathCache::clear()
+{
+    entries.clear();
+    index.clear();
+    regionIndex.clear();
+    pathBytes = 0;
+}
+
+void PathCache::erase(std::list<Entry>::iterator entry)
+{
+    for (long long region : entry->regions)
+    {
+        auto found = regionIndex.find(region);
+        found->second.erase(entry->key);
+        if (found->second.empty())
+        {
+            regionIndex.erase(found);
+        }
+    }
+
+    pathBytes -= entry->path.memoryUsage();
+    index.erase(entry->key);
+    entries.erase(entry);
+}
\ No newline at end of file
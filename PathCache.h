@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
+#include <algorithm>
+#include "CompactPath.h"
+#include "Clearance.h"
+
+// Bounded LRU cache of search results keyed by (algorithm, start, goal, agent size)
+// The grid is split into square regions, and every cached path remembers the regions it
+// passes through; a new wall only drops the paths that cross the edited region
+// Removing a wall never makes a path invalid, but anywhere on the map it can open a shortcut,
+// so it drops every path of an optimal search that is longer than the Manhattan distance
+// Paths are kept run-length encoded (see CompactPath.h), so long routes cost a few bytes
+class PathCache
+{
+public:
+    struct Key
+    {
+        int algorithm;
+        int startRow;
+        int startCol;
+        int endRow;
+        int endCol;
+        int agentSize;
+
+        bool operator==(const Key &other) const
+        {
+            return algorithm == other.algorithm && startRow == other.startRow && startCol == other.startCol &&
+                   endRow == other.endRow && endCol == other.endCol && agentSize == other.agentSize;
+        }
+    };
+
+    static const int DEFAULT_REGION_SIZE = 16;
+
+    // insert() only registers the corners of an agent's footprint, which needs agents no wider than a region
+    static_assert(MAX_CLEARANCE <= DEFAULT_REGION_SIZE, "an agent footprint must fit in one cache region");
+
+    PathCache(int capacity = 256, int regionSize = DEFAULT_REGION_SIZE) :
+        capacity(capacity), regionSize(std::max(regionSize, MAX_CLEARANCE)) {}
+
+    // Cached path for the key, or nullptr; a hit makes the entry the most recently used
+    const CompactPath *find(const Key &key);
+
+    // Store a path, evicting the least recently used entry when the cache is full
+    // optimal tells that the path is a shortest one, which a removed wall can make outdated
+    void insert(const Key &key, const CompactPath &path, bool optimal);
+
+    // After a wall was added at (row, col): drop every path that passes through its region
+    void invalidate(int row, int col);
+
+    // After a wall was removed: drop every optimal path that a shortcut could make shorter
+    void invalidateShortcuts();
+
+    void clear();
+
+    int size() const
+    {
+        return entries.size();
+    }
+
+    long long getHits() const
+    {
+        return hits;
+    }
+
+    long long getMisses() const
+    {
+        return misses;
+    }
+
+    long long getInvalidations() const
+    {
+        return invalidations;
+    }
+
+    // Bytes used by the cached paths
+    size_t getPathBytes() const
+    {
+        return pathBytes;
+    }
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(const Key &key) const
+        {
+            std::size_t hash = key.algorithm;
+            for (int value : {key.startRow, key.startCol, key.endRow, key.endCol, key.agentSize})
+            {
+                hash = hash * 1000003u ^ static_cast<std::size_t>(value);
+            }
+            return hash;
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        CompactPath path;
+        std::vector<long long> regions;
+        bool improvable; // Optimal, and longer than the Manhattan distance between its ends
+    };
+
+    long long regionOf(int row, int col) const
+    {
+        return (static_cast<long long>(row / regionSize) << 32) | static_cast<unsigned>(col / regionSize);
+    }
+
+    void erase(std::list<Entry>::iterator entry);
+
+    int capacity;
+    int regionSize;
+
+    // Most recently used entries first
+    std::list<Entry> entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    std::unordered_map<long long, std::unordered_set<Key, KeyHash>> regionIndex;
+
+    long long hits = 0;
+    long long misses = 0;
+    long long invalidations = 0;
+    size_t pathBytes = 0;
+};
\ No newline at end of file
@@ -0,0 +1,896 @@
+#include "PathService.h"
+#include "MapFile.h"
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <cstring>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <csignal>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <climits>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace
+{
+    // Minimal JSON value, enough for the request objects of the protocol
+    struct JsonValue
+    {
+        enum class Type
+        {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        Type type = Type::Null;
+        std::string raw; // The value exactly as it appeared in the request
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> array;
+        std::map<std::string, JsonValue> object;
+
+        const JsonValue *get(const std::string &key) const
+        {
+            auto found = object.find(key);
+            return found == object.end() ? nullptr : &found->second;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        explicit JsonParser(const std::string &text) : text(text) {}
+
+        bool parse(JsonValue &value)
+        {
+            return parseValue(value) && (skipSpaces(), pos == text.size());
+        }
+
+    private:
+        void skipSpaces()
+        {
+            while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            {
+                ++pos;
+            }
+        }
+
+        bool consume(char c)
+        {
+            skipSpaces();
+            if (pos < text.size() && text[pos] == c)
+            {
+                ++pos;
+                return true;
+            }
+            return false;
+        }
+
+        bool parseString(std::string &out)
+        {
+            if (!consume('"'))
+            {
+                return false;
+            }
+            while (pos < text.size() && text[pos] != '"')
+            {
+                if (text[pos] != '\\')
+                {
+                    out += text[pos++];
+                    continue;
+                }
+                if (++pos >= text.size())
+                {
+                    return false;
+                }
+
+                char escaped = text[pos++];
+                switch (escaped)
+                {
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u':
+                {
+                    unsigned code = 0;
+                    if (!readHex(code))
+                    {
+                        return false;
+                    }
+                    // A high surrogate followed by a low one encodes a code point above U+FFFF
+                    unsigned low = 0;
+                    if (code >= 0xD800 && code < 0xDC00 && text.compare(pos, 2, "\\u") == 0)
+                    {
+                        pos += 2;
+                        if (!readHex(low) || low < 0xDC00 || low >= 0xE000)
+                        {
+                            return false;
+                        }
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, code);
+                    break;
+                }
+                default:
+                    out += escaped; // \", \\ and \/
+                }
+            }
+            return consume('"');
+        }
+
+        bool readHex(unsigned &code)
+        {
+            if (pos + 4 > text.size())
+            {
+                return false;
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                char c = text[pos++];
+                if (!std::isxdigit(static_cast<unsigned char>(c)))
+                {
+                    return false;
+                }
+                code = code * 16 + (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : (std::tolower(c) - 'a' + 10));
+            }
+            return true;
+        }
+
+        static void appendUtf8(std::string &out, unsigned code)
+        {
+            if (code < 0x80)
+            {
+                out += char(code);
+            }
+            else if (code < 0x800)
+            {
+                out += char(0xC0 | code >> 6);
+                out += char(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                out += char(0xE0 | code >> 12);
+                out += char(0x80 | (code >> 6 & 0x3F));
+                out += char(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                out += char(0xF0 | code >> 18);
+                out += char(0x80 | (code >> 12 & 0x3F));
+                out += char(0x80 | (code >> 6 & 0x3F));
+                out += char(0x80 | (code & 0x3F));
+            }
+        }
+
+        bool parseValue(JsonValue &value)
+        {
+            skipSpaces();
+            size_t start = pos;
+            bool parsed = parseToken(value);
+            if (parsed)
+            {
+                value.raw = text.substr(start, pos - start);
+            }
+            return parsed;
+        }
+
+        bool parseToken(JsonValue &value)
+        {
+            if (pos >= text.size())
+            {
+                return false;
+            }
+
+            char c = text[pos];
+            if (c == '{')
+            {
+                ++pos;
+                value.type = JsonValue::Type::Object;
+                if (consume('}'))
+                {
+                    return true;
+                }
+                do
+                {
+                    std::string key;
+                    if (!parseString(key) || !consume(':') || !parseValue(value.object[key]))
+                    {
+                        return false;
+                    }
+                } while (consume(','));
+                return consume('}');
+            }
+            if (c == '[')
+            {
+                ++pos;
+                value.type = JsonValue::Type::Array;
+                if (consume(']'))
+                {
+                    return true;
+                }
+                do
+                {
+                    value.array.emplace_back();
+                    if (!parseValue(value.array.back()))
+                    {
+                        return false;
+                    }
+                } while (consume(','));
+                return consume(']');
+            }
+            if (c == '"')
+            {
+                value.type = JsonValue::Type::String;
+                return parseString(value.string);
+            }
+            if (text.compare(pos, 4, "true") == 0 || text.compare(pos, 5, "false") == 0)
+            {
+                value.type = JsonValue::Type::Bool;
+                value.boolean = text[pos] == 't';
+                pos += value.boolean ? 4 : 5;
+                return true;
+            }
+            if (text.compare(pos, 4, "null") == 0)
+            {
+                pos += 4;
+                return true;
+            }
+
+            // strtod also reads hexadecimal, inf and nan, which JSON doesn't have
+            if (c != '-' && !std::isdigit(static_cast<unsigned char>(c)))
+            {
+                return false;
+            }
+            char *end = nullptr;
+            value.number = std::strtod(text.c_str() + pos, &end);
+            if (end == text.c_str() + pos ||
+                std::find_if(text.c_str() + pos, static_cast<const char *>(end), [](char digit)
+                             { return !std::isdigit(static_cast<unsigned char>(digit)) && !std::strchr("+-.eE", digit); }) != end)
+            {
+                return false;
+            }
+            value.type = JsonValue::Type::Number;
+            pos = end - text.c_str();
+            return true;
+        }
+
+        const std::string &text;
+        size_t pos = 0;
+    };
+
+    // JSON numbers are doubles, only whole numbers in the range of int are cells and sizes
+    bool toInt(const JsonValue &value, int &out)
+    {
+        if (value.type != JsonValue::Type::Number || value.number != std::floor(value.number) ||
+            value.number < INT_MIN || value.number > INT_MAX)
+        {
+            return false;
+        }
+        out = static_cast<int>(value.number);
+        return true;
+    }
+
+    bool readPosition(const JsonValue *value, Position &pos)
+    {
+        int row;
+        int col;
+        if (!value || value->type != JsonValue::Type::Array || value->array.size() != 2 ||
+            !toInt(value->array[0], row) || !toInt(value->array[1], col))
+        {
+            return false;
+        }
+        pos = Position(row, col);
+        return true;
+    }
+
+    // A missing key keeps the default in out, a value that isn't an int is an error
+    bool readInt(const JsonValue &request, const std::string &key, int &out)
+    {
+        const JsonValue *value = request.get(key);
+        return !value || toInt(*value, out);
+    }
+
+    // Quote a string for the responses, escaping what JSON doesn't allow as it is
+    std::string jsonString(const std::string &text)
+    {
+        std::string out = "\"";
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+                out += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", c);
+                out += code;
+            }
+            else
+            {
+                out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    // The id is echoed exactly as the client sent it, so large integers keep every digit
+    std::string idField(const JsonValue &request)
+    {
+        const JsonValue *id = request.get("id");
+        if (!id)
+        {
+            return "{";
+        }
+        return "{\"id\": " + id->raw + ", ";
+    }
+
+    std::string error(const JsonValue &request, const std::string &message)
+    {
+        return idField(request) + "\"error\": " + jsonString(message) + "}";
+    }
+
+    enum class Algorithm
+    {
+        BFS,
+        DFS,
+        Dijkstra,
+        Astar,
+        ThetaStar,
+        Subgoal
+    };
+
+    bool readAlgorithm(const JsonValue &request, Algorithm &algorithm)
+    {
+        const JsonValue *value = request.get("algorithm");
+        std::string name = value && value->type == JsonValue::Type::String ? value->string : "astar";
+
+        static const std::map<std::string, Algorithm> names = {
+            {"bfs", Algorithm::BFS}, {"dfs", Algorithm::DFS}, {"dijkstra", Algorithm::Dijkstra},
+            {"astar", Algorithm::Astar}, {"theta", Algorithm::ThetaStar}, {"subgoal", Algorithm::Subgoal}};
+
+        auto found = names.find(name);
+        if (found == names.end())
+        {
+            return false;
+        }
+        algorithm = found->second;
+        return true;
+    }
+}
+
+bool PathService::loadTextMap(const std::string &path, SearchGrid &grid)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!line.empty())
+        {
+            lines.push_back(line);
+        }
+    }
+    if (lines.empty())
+    {
+        return false;
+    }
+
+    // Every row is as wide as the first one, shorter lines end with free cells
+    grid = SearchGrid(lines.size(), lines[0].size(), [&](int row, int col)
+    {
+        return col < (int)lines[row].size() && lines[row][col] == '#';
+    });
+    return true;
+}
+
+bool PathService::loadMap(const std::string &path, SearchGrid &grid)
+{
+    if (!MapFile::isMapFile(path))
+    {
+        return loadTextMap(path, grid);
+    }
+
+    MapFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    // Walls are read straight from the mapped bitset, or from the one RLE walls were expanded into
+    grid = SearchGrid(file.rows(), file.cols(), [&](int row, int col) { return file.isWall(row, col); });
+    return true;
+}
+
+std::vector<std::string> PathService::handleRound(const std::vector<std::string> &requests)
+{
+    const int rows = searchGrid.getLayout().rows;
+    const int cols = searchGrid.getLayout().cols;
+
+    auto inside = [&](const Position &pos)
+    {
+        return pos.row >= 0 && pos.row < rows && pos.col >= 0 && pos.col < cols;
+    };
+
+    // A path query waiting to be searched
+    struct Query
+    {
+        size_t index;
+        Algorithm algorithm;
+        Position start;
+        std::vector<Position> goals;
+        int agentSize;
+        CompactPath path;
+    };
+
+    std::vector<JsonValue> parsed(requests.size());
+    std::vector<std::string> responses(requests.size());
+    std::vector<Query> queries;
+
+    auto formatPath = [](const JsonValue &request, const CompactPath &path)
+    {
+        std::ostringstream out;
+        out << idField(request) << "\"found\": " << (path.empty() ? "false" : "true");
+        if (!path.empty())
+        {
+            // Distance along the path: the number of steps for grid paths, and the sum of the
+            // straight segments between the turning points of ThetaStar
+            double length = 0.0;
+            std::pair<int, int> previous = path.front();
+            for (const auto &cell : path)
+            {
+                length += std::hypot(cell.first - previous.first, cell.second - previous.second);
+                previous = cell;
+            }
+
+            out << ", \"goal\": [" << path.back().first << ", " << path.back().second << "]"
+                << ", \"length\": ";
+            if (length == std::floor(length))
+            {
+                out << static_cast<long long>(length);
+            }
+            else
+            {
+                char text[32];
+                std::snprintf(text, sizeof(text), "%.3f", length);
+                out << text;
+            }
+            out << ", \"path\": [";
+            bool first = true;
+            for (const auto &cell : path)
+            {
+                out << (first ? "[" : ", [") << cell.first << ", " << cell.second << "]";
+                first = false;
+            }
+            out << "]";
+        }
+        out << "}";
+        return out.str();
+    };
+
+    auto cacheKey = [](const Query &query)
+    {
+        return PathCache::Key{static_cast<int>(query.algorithm), query.start.row, query.start.col,
+                              query.goals[0].row, query.goals[0].col, query.agentSize};
+    };
+
+    // Searches only read the grid, so the queries collected between two edits run in parallel;
+    // single-goal results go through the path cache, and duplicates in the round are searched once
+    auto flushQueries = [&]()
+    {
+        std::vector<Query *> pending;
+        std::vector<std::pair<Query *, Query *>> duplicates;
+
+        for (Query &query : queries)
+        {
+            if (query.goals.size() == 1)
+            {
+                if (const CompactPath *cached = pathCache.find(cacheKey(query)))
+                {
+                    query.path = *cached;
+                    responses[query.index] = formatPath(parsed[query.index], query.path);
+                    continue;
+                }
+
+                auto same = std::find_if(pending.begin(), pending.end(), [&](Query *other)
+                {
+                    return other->goals.size() == 1 && cacheKey(*other) == cacheKey(query);
+                });
+                if (same != pending.end())
+                {
+                    duplicates.emplace_back(&query, *same);
+                    continue;
+                }
+            }
+            pending.push_back(&query);
+        }
+
+        // Every query was answered by the cache, or the round had none
+        if (pending.empty())
+        {
+            queries.clear();
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        // Each worker searches in its own arena, kept across rounds so its buffer stays warm
+        // A query's scope covers the search and its result path, which is compacted before the
+        // scope ends, so nothing of the search but the compact path touches the global heap
+        auto worker = [&](SearchArena &arena)
+        {
+            SearchArena::Binding binding(arena);
+            for (size_t i = next++; i < pending.size(); i = next++)
+            {
+                Query &query = *pending[i];
+                SearchArena::Scope scope(arena);
+                switch (query.algorithm)
+                {
+                case Algorithm::BFS:
+                    query.path = CompactPath(BFS(searchGrid, query.start, query.goals, query.agentSize).pathPositions);
+                    break;
+                case Algorithm::DFS:
+                    query.path = CompactPath(DFS(searchGrid, query.start, query.goals, query.agentSize).pathPositions);
+                    break;
+                case Algorithm::Dijkstra:
+                    query.path = CompactPath(Dijkstra(searchGrid, query.start, query.goals, query.agentSize).pathPositions);
+                    break;
+                case Algorithm::Astar:
+                    query.path = CompactPath(Astar(searchGrid, query.start, query.goals, 1.0f, query.agentSize).pathPositions);
+                    break;
+                case Algorithm::ThetaStar:
+                    query.path = CompactPath(ThetaStar(searchGrid, query.start, query.goals, query.agentSize).waypoints);
+                    break;
+                case Algorithm::Subgoal:
+                    // The graph is built for agents of one node
+                    if (query.agentSize == 1)
+                        query.path = CompactPath(subgoalGraph.findPath(query.start, query.goals));
+                    else
+                        query.path = CompactPath(Astar(searchGrid, query.start, query.goals, 1.0f, query.agentSize).pathPositions);
+                    break;
+                }
+            }
+        };
+
+        size_t threadCount = std::min<size_t>(pending.size(), std::max(1u, std::thread::hardware_concurrency()));
+        while (arenas.size() < std::max<size_t>(threadCount, 1))
+        {
+            arenas.emplace_back(new SearchArena());
+        }
+
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < threadCount; ++t)
+        {
+            threads.emplace_back(worker, std::ref(*arenas[t]));
+        }
+        worker(*arenas[0]);
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Query *query : pending)
+        {
+            if (query->goals.size() == 1)
+            {
+                // DFS and Theta* paths are not shortest grid paths, a shortcut doesn't outdate them
+                bool optimal = query->algorithm != Algorithm::DFS && query->algorithm != Algorithm::ThetaStar;
+                pathCache.insert(cacheKey(*query), query->path, optimal);
+            }
+            responses[query->index] = formatPath(parsed[query->index], query->path);
+        }
+        for (const auto &duplicate : duplicates)
+        {
+            responses[duplicate.first->index] = formatPath(parsed[duplicate.first->index], duplicate.second->path);
+        }
+
+        queries.clear();
+    };
+
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        JsonValue &request = parsed[i];
+        if (!JsonParser(requests[i]).parse(request) || request.type != JsonValue::Type::Object)
+        {
+            responses[i] = "{\"error\": \"invalid JSON\"}";
+            continue;
+        }
+
+        const JsonValue *op = request.get("op");
+        std::string operation = op && op->type == JsonValue::Type::String ? op->string : "";
+
+        if (operation == "path")
+        {
+            Query query{i, Algorithm::Astar, Position(0, 0), {}, 1, {}};
+
+            if (!readAlgorithm(request, query.algorithm))
+            {
+                responses[i] = error(request, "unknown algorithm");
+                continue;
+            }
+
+            // Any goal that isn't a cell makes the whole query invalid rather than being skipped
+            bool valid = readPosition(request.get("start"), query.start) && readInt(request, "size", query.agentSize);
+            Position goal(0, 0);
+            if (const JsonValue *value = request.get("goal"))
+            {
+                valid = valid && readPosition(value, goal);
+                query.goals.push_back(goal);
+            }
+            if (const JsonValue *goalList = request.get("goals"))
+            {
+                valid = valid && goalList->type == JsonValue::Type::Array;
+                for (const JsonValue &value : goalList->array)
+                {
+                    valid = valid && readPosition(&value, goal);
+                    query.goals.push_back(goal);
+                }
+            }
+
+            valid = valid && inside(query.start) && !query.goals.empty() && query.agentSize >= 1;
+            for (const Position &pos : query.goals)
+            {
+                valid = valid && inside(pos);
+            }
+            if (!valid)
+            {
+                responses[i] = error(request, "invalid start, goal or size");
+                continue;
+            }
+
+            queries.push_back(query);
+            continue;
+        }
+
+        // Edits and stats apply after every query that arrived before them
+        flushQueries();
+
+        if (operation == "set")
+        {
+            Position pos(-1, -1);
+            const JsonValue *wall = request.get("wall");
+            if (!readInt(request, "row", pos.row) || !readInt(request, "col", pos.col) || !inside(pos) ||
+                !wall || wall->type != JsonValue::Type::Bool)
+            {
+                responses[i] = error(request, "invalid cell");
+                continue;
+            }
+
+            if (searchGrid.isWall(pos.row, pos.col) != wall->boolean)
+            {
+                searchGrid.setWall(pos.row, pos.col, wall->boolean);
+                subgoalGraph.update(pos.row, pos.col);
+                if (wall->boolean)
+                    pathCache.invalidate(pos.row, pos.col);
+                else
+                    pathCache.invalidateShortcuts();
+            }
+            responses[i] = idField(request) + "\"ok\": true}";
+        }
+        else if (operation == "stats")
+        {
+            size_t arenaBytes = 0;
+            for (const auto &arena : arenas)
+            {
+                arenaBytes = std::max(arenaBytes, arena->getHighWater());
+            }
+
+            std::ostringstream out;
+            out << idField(request) << "\"rows\": " << rows << ", \"cols\": " << cols
+                << ", \"cached\": " << pathCache.size() << ", \"hits\": " << pathCache.getHits()
+                << ", \"misses\": " << pathCache.getMisses() << ", \"invalidations\": " << pathCache.getInvalidations()
+                << ", \"cachedBytes\": " << pathCache.getPathBytes() << ", \"arenaBytes\": " << arenaBytes << "}";
+            responses[i] = out.str();
+        }
+        else
+        {
+            responses[i] = error(request, "unknown op");
+        }
+    }
+
+    flushQueries();
+    return responses;
+}
+
+void PathService::runStdio()
+{
+    std::vector<Client> clients = {Client{STDIN_FILENO, STDOUT_FILENO}};
+    serve(clients, -1);
+}
+
+bool PathService::runSocket(const std::string &socketPath)
+{
+    sockaddr_un address = {};
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socketPath.c_str());
+    if (listenFd < 0 || bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || listen(listenFd, 64) < 0)
+    {
+        if (listenFd >= 0)
+        {
+            close(listenFd);
+        }
+        return false;
+    }
+
+    // A client closing its end must not terminate the service
+    signal(SIGPIPE, SIG_IGN);
+
+    std::vector<Client> clients;
+    serve(clients, listenFd);
+    close(listenFd);
+    unlink(socketPath.c_str());
+    return true;
+}
+
+void PathService::serve(std::vector<Client> &clients, int listenFd)
+{
+    char chunk[65536];
+
+    while (!clients.empty() || listenFd >= 0)
+    {
+        // Each client is polled for requests and, while responses wait for it, for room to write them
+        // A client that doesn't read its responses isn't read from until they drain
+        std::vector<pollfd> fds;
+        for (const Client &client : clients)
+        {
+            bool reading = !client.inputClosed && client.output.size() < MAX_PENDING_OUTPUT;
+            fds.push_back(pollfd{reading ? client.inFd : -1, POLLIN, 0});
+            fds.push_back(pollfd{client.output.empty() ? -1 : client.outFd, POLLOUT, 0});
+        }
+        if (listenFd >= 0)
+        {
+            fds.push_back(pollfd{listenFd, POLLIN, 0});
+        }
+
+        // Block until something arrives or can be written, then take everything that is ready as one round
+        if (poll(fds.data(), fds.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+
+        std::vector<std::string> requests;
+        std::vector<size_t> owners;
+        std::vector<bool> closed(clients.size(), false);
+
+        auto addRequest = [&](std::string line, size_t owner)
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (!line.empty())
+            {
+                requests.push_back(line);
+                owners.push_back(owner);
+            }
+        };
+
+        for (size_t i = 0; i < clients.size(); ++i)
+        {
+            Client &client = clients[i];
+            if ((fds[2 * i + 1].revents & (POLLOUT | POLLHUP | POLLERR)) && !flushOutput(client))
+            {
+                closed[i] = true;
+                continue;
+            }
+            if (!(fds[2 * i].revents & (POLLIN | POLLHUP | POLLERR)))
+            {
+                continue;
+            }
+
+            ssize_t count = read(client.inFd, chunk, sizeof(chunk));
+            if (count > 0)
+            {
+                client.buffer.append(chunk, count);
+            }
+            else if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            {
+                client.inputClosed = true;
+            }
+
+            // Split complete lines, a partial line waits for the next round unless the input ended after it
+            size_t begin = 0;
+            size_t end;
+            while ((end = client.buffer.find('\n', begin)) != std::string::npos)
+            {
+                addRequest(client.buffer.substr(begin, end - begin), i);
+                begin = end + 1;
+            }
+            client.buffer.erase(0, begin);
+            if (client.inputClosed)
+            {
+                addRequest(client.buffer, i);
+                client.buffer.clear();
+            }
+        }
+
+        std::vector<std::string> responses = handleRound(requests);
+        for (size_t i = 0; i < responses.size(); ++i)
+        {
+            clients[owners[i]].output += responses[i] + "\n";
+        }
+
+        // Whatever doesn't fit now is flushed once the client's output polls writable
+        for (size_t i = clients.size(); i-- > 0;)
+        {
+            Client &client = clients[i];
+            closed[i] = closed[i] || !flushOutput(client) || (client.inputClosed && client.output.empty());
+            if (closed[i])
+            {
+                if (client.inFd != STDIN_FILENO)
+                {
+                    close(client.inFd);
+                }
+                clients.erase(clients.begin() + i);
+            }
+        }
+
+        if (listenFd >= 0 && (fds.back().revents & POLLIN))
+        {
+            int clientFd = accept(listenFd, nullptr, nullptr);
+            if (clientFd >= 0)
+            {
+                // Socket clients never block the loop, stdout is left as it is since it serves only one client
+                fcntl(clientFd, F_SETFL, fcntl(clientFd, F_GETFL) | O_NONBLOCK);
+                clients.push_back(Client{clientFd, clientFd});
+            }
+        }
+    }
+}
+
+bool PathService::flushOutput(Client &client)
+{
+    while (!client.output.empty())
+    {
+        ssize_t count = write(client.outFd, client.output.data(), client.output.size());
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return true;
+        }
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        client.output.erase(0, count);
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "Pathfinder.h"
+#include "PathCache.h"
+#include "SubgoalGraph.h"
+#include "SearchArena.h"
+
+// Headless pathfinding service speaking JSON lines over stdin/stdout or a Unix domain socket
+// The map is held only as a SearchGrid built straight from the file (see SearchGrid.h), with
+// its clearance, the subgoal graph and the path cache kept in memory between requests; the
+// service never creates the editor's nodes
+//
+// Requests, one JSON object per line:
+//   {"id": 1, "op": "path", "algorithm": "astar", "start": [row, col], "goal": [row, col], "size": 1}
+//   {"id": 2, "op": "path", "algorithm": "bfs", "start": [row, col], "goals": [[row, col], [row, col]]}
+//   {"id": 3, "op": "set", "row": 4, "col": 7, "wall": true}
+//   {"id": 4, "op": "stats"}
+// Responses carry the same id:
+//   {"id": 1, "found": true, "goal": [row, col], "length": 12, "path": [[row, col], ...]}
+//   {"id": 3, "ok": true}
+//   {"id": 4, "rows": 40, "cols": 60, "cached": 3, "hits": 10, "misses": 4, "invalidations": 1, "cachedBytes": 180,
+//    "arenaBytes": 4096}
+//   {"id": 5, "error": "message"}
+// length is the distance along the path, for theta the sum of its straight segments
+// Algorithms: bfs, dfs, dijkstra, astar, theta (theta returns the turning points of the path),
+// subgoal (A* on the subgoal graph, see SubgoalGraph.h)
+class PathService
+{
+public:
+    explicit PathService(SearchGrid grid) : searchGrid(std::move(grid)), subgoalGraph(searchGrid) {}
+
+    // The subgoal graph points at the service's own SearchGrid
+    PathService(const PathService &) = delete;
+    PathService &operator=(const PathService &) = delete;
+
+    // Serve a single client on stdin/stdout until end of input
+    void runStdio();
+
+    // Serve any number of clients connected to a Unix domain socket
+    bool runSocket(const std::string &socketPath);
+
+    // Handle one scheduling round: every request that arrived together, answered in order
+    // Queries between two edits are searched in parallel, the searches only read the grid
+    std::vector<std::string> handleRound(const std::vector<std::string> &requests);
+
+    // Load the walls of a text map: '#' wall, anything else free, one line per row
+    static bool loadTextMap(const std::string &path, SearchGrid &grid);
+
+    // Load the walls of a binary .pfm map (see MapFile.h) or, failing that, of a text map
+    static bool loadMap(const std::string &path, SearchGrid &grid);
+
+private:
+    // Responses a client hasn't read yet, past this its requests aren't read until they drain
+    static const size_t MAX_PENDING_OUTPUT = 1 << 20;
+
+    struct Client
+    {
+        int inFd;
+        int outFd;
+        std::string buffer;
+        std::string output;
+        bool inputClosed = false;
+    };
+
+    void serve(std::vector<Client> &clients, int listenFd);
+
+    // Write as much of a client's pending output as it takes without blocking, false once it fails
+    static bool flushOutput(Client &client);
+
+    SearchGrid searchGrid;
+    SubgoalGraph subgoalGraph;
+    PathCache pathCache;
+
+    // One search arena per worker thread, see SearchArena.h
+    std::vector<std::unique_ptr<SearchArena>> arenas;
+};
\ No newline at end of file
@@ -1,28 +1,157 @@
 #include "Pathfinder.h"
+#include "Bresenham.h"
+#include <cmath>
+#include <cfloat>
 
 // Find the coordinates of the start and end nodes on the grid
 void Pathfinder::findStartEndNodes()
 {
-    for (int row = 0; row < grid.size(); ++row)
+    endNodes.clear();
+    goalSet.clear();
+
+    for (int row = 0; row < rows; ++row)
     {
-        for (int col = 0; col < grid[0].size(); ++col)
+        for (int col = 0; col < cols; ++col)
         {
-            if (grid[row][col].type == Node::NodeType::Start)
+            const Node &node = (*grid)[row][col];
+            if (node.type == Node::NodeType::Start)
             {
                 startRow = row;
                 startCol = col;
             }
-            else if (grid[row][col].type == Node::NodeType::End)
+            else if (node.type == Node::NodeType::End)
             {
-                endRow = row;
-                endCol = col;
+                endNodes.emplace_back(row, col);
             }
         }
     }
+
+    if (!endNodes.empty())
+    {
+        endRow = endNodes[0].row;
+        endCol = endNodes[0].col;
+    }
+}
+
+void GoalSet::buildDistances(const std::vector<Position> &goals, int rows, int cols)
+{
+    this->cols = cols;
+    nearby.clear();
+    field.clear();
+    distancesBuilt = true;
+
+    top = left = INT_MAX;
+    bottom = right = INT_MIN;
+    for (const Position &goal : goals)
+    {
+        top = std::min(top, goal.row);
+        left = std::min(left, goal.col);
+        bottom = std::max(bottom, goal.row);
+        right = std::max(right, goal.col);
+    }
+
+    if (goals.size() <= FEW_GOALS)
+    {
+        nearby.assign(goals.begin(), goals.end());
+        return;
+    }
+
+    // Two passes give the exact Manhattan distance: one from the top-left, one from the bottom-right
+    field.assign(rows * cols, INT_MAX / 2);
+    for (const Position &goal : goals)
+    {
+        field[goal.row * cols + goal.col] = 0;
+    }
+    for (int row = 0; row < rows; ++row)
+    {
+        for (int col = 0; col < cols; ++col)
+        {
+            int &distance = field[row * cols + col];
+            if (row > 0)
+                distance = std::min(distance, field[(row - 1) * cols + col] + 1);
+            if (col > 0)
+                distance = std::min(distance, field[row * cols + col - 1] + 1);
+        }
+    }
+    for (int row = rows - 1; row >= 0; --row)
+    {
+        for (int col = cols - 1; col >= 0; --col)
+        {
+            int &distance = field[row * cols + col];
+            if (row < rows - 1)
+                distance = std::min(distance, field[(row + 1) * cols + col] + 1);
+            if (col < cols - 1)
+                distance = std::min(distance, field[row * cols + col + 1] + 1);
+        }
+    }
+}
+
+void GoalSet::clear()
+{
+    bits.clear();
+    nearby.clear();
+    field.clear();
+    distancesBuilt = false;
+}
+
+int GoalSet::manhattan(int row, int col) const
+{
+    if (!field.empty())
+    {
+        return field[row * cols + col];
+    }
+
+    int distance = INT_MAX;
+    for (const Position &goal : nearby)
+    {
+        distance = std::min(distance, std::abs(goal.row - row) + std::abs(goal.col - col));
+    }
+    return distance;
+}
+
+float GoalSet::euclidean(int row, int col) const
+{
+    auto length = [](int dRow, int dCol) { return std::sqrt(static_cast<float>(dRow * dRow + dCol * dCol)); };
+
+    if (field.empty())
+    {
+        float distance = FLT_MAX;
+        for (const Position &goal : nearby)
+        {
+            distance = std::min(distance, length(goal.row - row, goal.col - col));
+        }
+        return distance;
+    }
+
+    // A straight line is at least the Manhattan distance over sqrt(2), and at least the distance
+    // to the box around the goals
+    int dRow = std::max({0, top - row, row - bottom});
+    int dCol = std::max({0, left - col, col - right});
+    return std::max(length(dRow, dCol), field[row * cols + col] / std::sqrt(2.0f));
+}
+
+// Manhattan distance to the nearest end node
+// The minimum of admissible estimates is still admissible, so A* stops at the nearest goal
+int Pathfinder::goalHeuristic(int row, int col)
+{
+    if (!goalSet.hasDistances())
+    {
+        goalSet.buildDistances(endNodes, rows, cols);
+    }
+    return goalSet.manhattan(row, col);
+}
+
+float Pathfinder::goalDistance(int row, int col)
+{
+    if (!goalSet.hasDistances())
+    {
+        goalSet.buildDistances(endNodes, rows, cols);
+    }
+    return goalSet.euclidean(row, col);
 }
 
 // Obtain the adjacent nodes for a given node position
-std::vector<Position> Pathfinder::getAdjacentNodes(const Position &pos)
+std::vector<Position> Pathfinder::getAdjacentNodes(const Position &pos) const
 {
     std::vector<Position> adjacentNodes;
 
@@ -30,7 +159,7 @@ std::vector<Position> Pathfinder::getAdjacentNodes(const Position &pos)
     {
         adjacentNodes.emplace_back(pos.row - 1, pos.col);
     }
-    if (pos.row < grid.size() - 1)
+    if (pos.row < rows - 1)
     {
         adjacentNodes.emplace_back(pos.row + 1, pos.col);
     }
@@ -38,7 +167,7 @@ std::vector<Position> Pathfinder::getAdjacentNodes(const Position &pos)
     {
         adjacentNodes.emplace_back(pos.row, pos.col - 1);
     }
-    if (pos.col < grid[0].size() - 1)
+    if (pos.col < cols - 1)
     {
         adjacentNodes.emplace_back(pos.row, pos.col + 1);
     }
@@ -46,8 +175,60 @@ std::vector<Position> Pathfinder::getAdjacentNodes(const Position &pos)
     return adjacentNodes;
 }
 
+// Check if the straight line between two nodes only crosses walkable nodes
+// Diagonal steps also need both nodes at the corner to be walkable, so lines can't squeeze between walls
+bool Pathfinder::lineOfSight(int row1, int col1, int row2, int col2) const
+{
+    int previousRow = row1;
+    int previousCol = col1;
+
+    return traceLine(col1, row1, col2, row2, [&](int col, int row)
+    {
+        if (!isWalkable(row, col))
+        {
+            return false;
+        }
+        if (row != previousRow && col != previousCol && (!isWalkable(previousRow, col) || !isWalkable(row, previousCol)))
+        {
+            return false;
+        }
+
+        previousRow = row;
+        previousCol = col;
+        return true;
+    });
+}
+
+// Reduce pathPositions to its turning points, skipping every node that the previous
+// turning point can see directly; works on the output of any algorithm
+void Pathfinder::smoothPath()
+{
+    waypoints.clear();
+    if (pathPositions.empty())
+    {
+        return;
+    }
+
+    int current = 0;
+    waypoints.push_back(pathPositions[0]);
+
+    while (current < (int)pathPositions.size() - 1)
+    {
+        // Move forward as long as the next node is still in line of sight
+        int next = current + 1;
+        while (next + 1 < (int)pathPositions.size() &&
+               lineOfSight(pathPositions[current].first, pathPositions[current].second, pathPositions[next + 1].first, pathPositions[next + 1].second))
+        {
+            ++next;
+        }
+
+        waypoints.push_back(pathPositions[next]);
+        current = next;
+    }
+}
+
 // Obtain the path through the parent nodes
-void Pathfinder::obtainPath()
+void Pathfinder::obtainPath(const std::pmr::vector<int> &parents)
 {
     int row = endRow;
     int col = endCol;
@@ -55,13 +236,12 @@ void Pathfinder::obtainPath()
     while (row != startRow || col != startCol)
     {
         pathPositions.emplace_back(row, col);
-        
+
         // Get the parent coordinates of the current node
-        int parentRow = grid[row][col].parent.first;
-        int parentCol = grid[row][col].parent.second;
+        int parent = parents[row * cols + col];
 
-        row = parentRow;
-        col = parentCol;
+        row = parent / cols;
+        col = parent % cols;
     }
 
     // Add the start node to the path
@@ -71,16 +251,29 @@ void Pathfinder::obtainPath()
     std::reverse(pathPositions.begin(), pathPositions.end());
 }
 
-// Update node type to represent the path
+// Update node type to represent the path, or record it in the trace to be replayed later
+// Each path node keeps its predecessor as parent
 void Pathfinder::visualizePath()
 {
-    for (const auto &pos : pathPositions)
+    for (size_t i = 0; i < pathPositions.size(); ++i)
     {
-        int row = pos.first;
-        int col = pos.second;
-        if (grid[row][col].type != Node::NodeType::Start && grid[row][col].type != Node::NodeType::End)
+        int row = pathPositions[i].first;
+        int col = pathPositions[i].second;
+
+        if (trace)
+        {
+            trace->record(SearchTrace::Event::Path, row * cols + col);
+            continue;
+        }
+
+        Node &node = (*shownGrid)[row][col];
+        if (i > 0)
+        {
+            node.parent = pathPositions[i - 1];
+        }
+        if (node.type != Node::NodeType::Start && node.type != Node::NodeType::End)
         {
-            grid[row][col].type = Node::NodeType::Path;
+            node.type = Node::NodeType::Path;
         }
     }
 }
\ No newline at end of file
@@ -3,8 +3,15 @@
 #include <vector>
 #include <queue>
 #include <stack>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
 #include "Map.h"
+#include "SearchTrace.h"
+#include "SearchGrid.h"
+#include "SearchArena.h"
 
 struct Position
 {
@@ -24,75 +31,364 @@ struct Position
     }
 };
 
+// The end nodes of a search: one bit per cell for the end test and the distance to the nearest one
+// for the heuristics. Up to FEW_GOALS end nodes are checked one by one, past that a Manhattan
+// distance field over the whole grid (walls ignored) answers in constant time
+class GoalSet
+{
+public:
+    static const size_t FEW_GOALS = 8;
+
+    explicit GoalSet(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) :
+        bits(resource), nearby(resource), field(resource)
+    {
+    }
+
+    // contains() takes the ids index(row, col) gives the cells, from 0 to cells - 1
+    template <typename Index>
+    void markCells(const std::vector<Position> &goals, int cells, Index &&index)
+    {
+        bits.assign((cells + 63) / 64, 0);
+        for (const Position &goal : goals)
+        {
+            int id = index(goal.row, goal.col);
+            bits[id >> 6] |= uint64_t(1) << (id & 63);
+        }
+    }
+
+    void buildDistances(const std::vector<Position> &goals, int rows, int cols);
+    void clear();
+
+    bool hasCells() const { return !bits.empty(); }
+    bool hasDistances() const { return distancesBuilt; }
+    bool contains(int id) const { return (bits[id >> 6] >> (id & 63)) & 1; }
+
+    // Manhattan distance to the nearest goal, INT_MAX without goals
+    int manhattan(int row, int col) const;
+
+    // Never more than the straight-line distance to the nearest goal, for any-angle searches
+    float euclidean(int row, int col) const;
+
+private:
+    std::pmr::vector<uint64_t> bits;
+    std::pmr::vector<Position> nearby; // The goals themselves, when there are few of them
+    std::pmr::vector<int> field; // Row-major, when there are many
+    int cols = 0;
+    int top = 0, left = 0, bottom = -1, right = -1; // Bounding box of the goals
+    bool distancesBuilt = false;
+};
+
 class Pathfinder
 {
 public:
-    Pathfinder(std::vector<std::vector<Node>> &grid) : grid(grid)
+    // Agents of size k occupy a k x k square whose top-left corner is their position
+    // With a trace the search records its events there instead of showing the path on the grid
+    Pathfinder(std::vector<std::vector<Node>> &grid, int agentSize = 1, SearchTrace *trace = nullptr) :
+        grid(&grid), shownGrid(&grid), rows(grid.size()), cols(grid.empty() ? 0 : grid[0].size()), agentSize(agentSize), trace(trace)
     {
         findStartEndNodes();
     }
 
+    // Search between explicit nodes instead of the Start and End flags on the grid
+    Pathfinder(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        grid(&grid), shownGrid(&grid), rows(grid.size()), cols(grid.empty() ? 0 : grid[0].size()), agentSize(agentSize), startRow(start.row), startCol(start.col),
+        endNodes(ends)
+    {
+        if (!endNodes.empty())
+        {
+            endRow = endNodes[0].row;
+            endCol = endNodes[0].col;
+        }
+    }
+
+    // Search the compact copy of a grid (see SearchGrid.h) without reading any node, so it also
+    // works on a SearchGrid built straight from a map file; there is then nothing to visualize
+    // BFS, DFS, Dijkstra and A* read it through the kernel (see SearchKernel.h), ThetaStar cell by cell
+    Pathfinder(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        searchGrid(&searchGrid), rows(searchGrid.getLayout().rows), cols(searchGrid.getLayout().cols), agentSize(agentSize),
+        startRow(start.row), startCol(start.col), endNodes(ends)
+    {
+        if (!endNodes.empty())
+        {
+            endRow = endNodes[0].row;
+            endCol = endNodes[0].col;
+        }
+    }
+
     void findStartEndNodes();
-    void obtainPath();
+    // Follow the parents (row * cols + col, -1 if unreached) from the end node back to the start
+    void obtainPath(const std::pmr::vector<int> &parents);
     void visualizePath();
-    std::vector<Position> getAdjacentNodes(const Position &pos);
+    std::vector<Position> getAdjacentNodes(const Position &pos) const;
+
+    // The nodes of getAdjacentNodes, in the same order, without building a vector
+    template <typename Visit>
+    void forEachAdjacentNode(int row, int col, Visit &&visit) const
+    {
+        if (row > 0)
+            visit(row - 1, col);
+        if (row < rows - 1)
+            visit(row + 1, col);
+        if (col > 0)
+            visit(row, col - 1);
+        if (col < cols - 1)
+            visit(row, col + 1);
+    }
+
+    // Distance to the nearest end node, Manhattan for grid paths and straight-line for any-angle ones
+    int goalHeuristic(int row, int col);
+    float goalDistance(int row, int col);
+    bool lineOfSight(int row1, int col1, int row2, int col2) const;
+    void smoothPath();
+
+    // Looks up one bit per cell, built on the first call, so many end nodes cost nothing per node
+    bool isEndNode(int row, int col)
+    {
+        if (!goalSet.hasCells())
+        {
+            goalSet.markCells(endNodes, rows * cols, [this](int row, int col) { return row * cols + col; });
+        }
+        return goalSet.contains(row * cols + col);
+    }
+
+    // Agents bigger than one node only need the precomputed clearance, see Clearance.h
+    bool isWalkable(int row, int col) const
+    {
+        if (!grid)
+        {
+            return searchGrid->isWalkable(searchGrid->getLayout().index(row, col), agentSize);
+        }
+        if (agentSize == 1)
+        {
+            return (*grid)[row][col].type != Node::NodeType::Wall;
+        }
+        return (*grid)[row][col].clearance >= agentSize;
+    }
 
-    std::vector<std::vector<Node>> &grid;
+    // The grid is only read by the searches, their state lives in private scratch memory
+    // A Pathfinder searches either the nodes or, when grid is nullptr, only searchGrid
+    // shownGrid is the same nodes, written only by visualizePath when there is no trace
+    const std::vector<std::vector<Node>> *grid = nullptr;
+    std::vector<std::vector<Node>> *shownGrid = nullptr;
+    const SearchGrid *searchGrid = nullptr;
+    int rows;
+    int cols;
+    int agentSize;
+    SearchTrace *trace = nullptr;
     int startRow = -1;
     int startCol = -1;
+
+    // All end nodes on the grid; after a search endRow/endCol hold the one that was reached
+    std::vector<Position> endNodes;
     int endRow = -1;
     int endCol = -1;
-    std::vector<std::pair<int, int>> pathPositions;
+
+    // The end nodes for isEndNode and the heuristics, each part built when it is first needed
+    GoalSet goalSet;
+
+    // The results come from the SearchArena scope open when the Pathfinder is created, if any,
+    // so a Pathfinder made inside a scope must not outlive it; the searches' scratch memory,
+    // parents included, always comes from the arena and is gone when the search returns
+    std::pmr::vector<std::pair<int, int>> pathPositions{SearchArena::activeResource()};
+
+    // Turning points of the path, filled by smoothPath() or ThetaStar
+    std::pmr::vector<std::pair<int, int>> waypoints{SearchArena::activeResource()};
 };
 
 class BFS : public Pathfinder
 {
 public:
-    BFS(std::vector<std::vector<Node>> &grid) : Pathfinder(grid)
+    BFS(std::vector<std::vector<Node>> &grid, int agentSize = 1, SearchTrace *trace = nullptr) : Pathfinder(grid, agentSize, trace)
     {
         findStartEndNodes();
         searchPath();
         visualizePath();
     }
 
+    BFS(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
+    BFS(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(searchGrid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
     void searchPath();
 };
 
 class DFS : public Pathfinder
 {
 public:
-    DFS(std::vector<std::vector<Node>> &grid) : Pathfinder(grid)
+    DFS(std::vector<std::vector<Node>> &grid, int agentSize = 1, SearchTrace *trace = nullptr) : Pathfinder(grid, agentSize, trace)
     {
         findStartEndNodes();
         searchPath();
         visualizePath();
     }
 
+    DFS(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
+    DFS(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(searchGrid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
     void searchPath();
 };
 
+class ParallelBFS : public Pathfinder
+{
+public:
+    // Level-synchronous BFS for large grids, each frontier level is expanded by several threads
+    // A thread count of 0 uses one thread per hardware core
+    ParallelBFS(std::vector<std::vector<Node>> &grid, int threadCount = 0, int agentSize = 1, SearchTrace *trace = nullptr) :
+        Pathfinder(grid, agentSize, trace), threadCount(threadCount)
+    {
+        findStartEndNodes();
+        searchPath();
+        visualizePath();
+    }
+
+    ParallelBFS(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int threadCount = 0, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize), threadCount(threadCount)
+    {
+        searchPath();
+    }
+
+    void searchPath();
+
+    int threadCount;
+
+    // BFS level of every cell (row * cols + col) reached by the search, -1 otherwise
+    std::pmr::vector<int> distances{SearchArena::activeResource()};
+};
+
 class Dijkstra : public Pathfinder
 {
 public:
-    Dijkstra(std::vector<std::vector<Node>> &grid) : Pathfinder(grid)
+    Dijkstra(std::vector<std::vector<Node>> &grid, int agentSize = 1, SearchTrace *trace = nullptr) : Pathfinder(grid, agentSize, trace)
     {
         findStartEndNodes();
         searchPath();
         visualizePath();
     }
 
+    Dijkstra(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
+    Dijkstra(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(searchGrid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
     void searchPath();
 };
 
 class Astar : public Pathfinder
 {
 public:
-    Astar(std::vector<std::vector<Node>> &grid) : Pathfinder(grid)
+    // A weight above 1 inflates the heuristic (weighted A*), the path found
+    // is then at most weight times longer than the optimal one
+    Astar(std::vector<std::vector<Node>> &grid, float weight = 1.0f, int agentSize = 1, SearchTrace *trace = nullptr) :
+        Pathfinder(grid, agentSize, trace), weight(weight)
     {
         findStartEndNodes();
         searchPath();
         visualizePath();
     }
 
+    Astar(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, float weight = 1.0f, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize), weight(weight)
+    {
+        searchPath();
+    }
+
+    Astar(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, float weight = 1.0f, int agentSize = 1) :
+        Pathfinder(searchGrid, start, ends, agentSize), weight(weight)
+    {
+        searchPath();
+    }
+
     void searchPath();
+
+    float weight;
+};
+
+class ThetaStar : public Pathfinder
+{
+public:
+    // Any-angle A*: a node's parent can be any node in line of sight, not only an adjacent one,
+    // so the path is a few straight segments stored in waypoints
+    ThetaStar(std::vector<std::vector<Node>> &grid, int agentSize = 1, SearchTrace *trace = nullptr) : Pathfinder(grid, agentSize, trace)
+    {
+        findStartEndNodes();
+        searchPath();
+        visualizePath();
+    }
+
+    ThetaStar(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
+    ThetaStar(const SearchGrid &searchGrid, const Position &start, const std::vector<Position> &ends, int agentSize = 1) :
+        Pathfinder(searchGrid, start, ends, agentSize)
+    {
+        searchPath();
+    }
+
+    void searchPath();
+};
+
+class ARAstar : public Pathfinder
+{
+public:
+    // Anytime Repairing A*: starts with an inflated heuristic to find a first path quickly,
+    // then lowers the weight and repairs the search while the time budget allows
+    // The first pass at initialWeight is always completed, the budget only cuts the later ones
+    ARAstar(std::vector<std::vector<Node>> &grid, float initialWeight = 3.0f, float weightStep = 0.5f, int timeBudgetMs = 50, int agentSize = 1,
+            SearchTrace *trace = nullptr) :
+        Pathfinder(grid, agentSize, trace), initialWeight(initialWeight), weightStep(weightStep), timeBudgetMs(timeBudgetMs)
+    {
+        findStartEndNodes();
+        searchPath();
+        visualizePath();
+    }
+
+    ARAstar(std::vector<std::vector<Node>> &grid, const Position &start, const std::vector<Position> &ends,
+            float initialWeight = 3.0f, float weightStep = 0.5f, int timeBudgetMs = 50, int agentSize = 1) :
+        Pathfinder(grid, start, ends, agentSize), initialWeight(initialWeight), weightStep(weightStep), timeBudgetMs(timeBudgetMs)
+    {
+        searchPath();
+    }
+
+    void searchPath();
+
+    struct Solution
+    {
+        std::vector<std::pair<int, int>> path;
+        int cost;
+        float bound; // The path cost is at most bound times the optimal cost
+    };
+
+    // Every path found, from the first (loosest) to the last (tightest)
+    std::vector<Solution> solutions;
+
+    float initialWeight;
+    float weightStep;
+    int timeBudgetMs;
 };
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "RealTimeSearch.h"
+#include <queue>
+#include <tuple>
+
+namespace
+{
+    const int DIRECTIONS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+}
+
+RealTimeAgent::RealTimeAgent(std::vector<std::vector<Node>> &grid, LearnedHeuristic &heuristic, const Position &start,
+                             const Position &goal, int lookahead) :
+    grid(grid), heuristic(heuristic), rows(grid.size()), cols(grid.empty() ? 0 : grid[0].size()), lookahead(std::max(lookahead, 1)),
+    cell(start.row * cols + start.col), goal(goal.row * cols + goal.col)
+{
+}
+
+bool RealTimeAgent::tick()
+{
+    lastExpansions = 0;
+    if (cell == goal || stuck)
+    {
+        return false;
+    }
+
+    // A wall drawn on the route since the last search makes the agent look again
+    if (!route.empty() && !isWalkable(route.back()))
+    {
+        route.clear();
+    }
+
+    if (route.empty() && !search())
+    {
+        stuck = true;
+        return false;
+    }
+
+    cell = route.back();
+    route.pop_back();
+    ++moves;
+    return true;
+}
+
+bool RealTimeAgent::search()
+{
+    struct Entry
+    {
+        int g;
+        int parent;
+        bool closed;
+    };
+    std::unordered_map<int, Entry> nodes;
+
+    // (f, -g, cell), ties go to the node further from the agent
+    typedef std::tuple<int, int, int> Key;
+    std::priority_queue<Key, std::vector<Key>, std::greater<Key>> open;
+
+    nodes[cell] = {0, -1, false};
+    open.push(Key(heuristic.get(cell, goal), 0, cell));
+
+    int target = -1;
+    std::vector<int> closed;
+
+    while (!open.empty())
+    {
+        int id = std::get<2>(open.top());
+        int g = -std::get<1>(open.top());
+        Entry &entry = nodes[id];
+        if (entry.closed || g != entry.g)
+        {
+            open.pop();
+            continue;
+        }
+
+        // The best frontier node is where the agent goes
+        if (id == goal || lastExpansions == lookahead)
+        {
+            target = id;
+            break;
+        }
+
+        open.pop();
+        entry.closed = true;
+        closed.push_back(id);
+        ++lastExpansions;
+
+        for (const auto &direction : DIRECTIONS)
+        {
+            int row = id / cols + direction[0];
+            int col = id % cols + direction[1];
+            if (row < 0 || row >= rows || col < 0 || col >= cols)
+                continue;
+
+            int next = row * cols + col;
+            if (!isWalkable(next))
+                continue;
+
+            auto known = nodes.find(next);
+            if (known != nodes.end() && (known->second.closed || known->second.g <= g + 1))
+                continue;
+
+            nodes[next] = {g + 1, id, false};
+            open.push(Key(g + 1 + heuristic.get(next, goal), -(g + 1), next));
+        }
+    }
+
+    if (target == -1)
+    {
+        // Everything reachable was expanded without meeting the goal
+        return false;
+    }
+
+    // Learning: every expanded node gets the lowest cost of reaching the goal through the
+    // frontier, h(s) = min over frontier f of distance(s, f) + h(f), a Dijkstra pass from the frontier
+    std::unordered_map<int, int> learned;
+    for (int id : closed)
+    {
+        learned[id] = INT_MAX;
+    }
+
+    typedef std::pair<int, int> Backup; // (h, cell)
+    std::priority_queue<Backup, std::vector<Backup>, std::greater<Backup>> frontier;
+    while (!open.empty())
+    {
+        int id = std::get<2>(open.top());
+        open.pop();
+        if (!nodes[id].closed)
+        {
+            frontier.push(Backup(heuristic.get(id, goal), id));
+        }
+    }
+
+    while (!frontier.empty())
+    {
+        auto [h, id] = frontier.top();
+        frontier.pop();
+
+        auto own = learned.find(id);
+        if (own != learned.end() && own->second < h)
+            continue;
+
+        for (const auto &direction : DIRECTIONS)
+        {
+            int row = id / cols + direction[0];
+            int col = id % cols + direction[1];
+            if (row < 0 || row >= rows || col < 0 || col >= cols)
+                continue;
+
+            auto neighbour = learned.find(row * cols + col);
+            if (neighbour != learned.end() && h + 1 < neighbour->second)
+            {
+                neighbour->second = h + 1;
+                frontier.push(Backup(h + 1, neighbour->first));
+            }
+        }
+    }
+
+    for (const auto &entry : learned)
+    {
+        if (entry.second != INT_MAX)
+        {
+            heuristic.set(entry.first, goal, entry.second);
+        }
+    }
+
+    // Route to the target, the agent is at its start
+    route.clear();
+    for (int id = target; id != cell; id = nodes[id].parent)
+    {
+        route.push_back(id);
+    }
+    return !route.empty();
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+#include "Pathfinder.h"
+#include "LearnedHeuristic.h"
+
+// Agent moving towards a goal with local search space LRTA* (LSS-LRTA*)
+// Every search is an A* limited to `lookahead` expansions around the agent; the heuristic of
+// the expanded nodes is then raised to what the search learned (a Dijkstra pass from the
+// frontier) and the agent walks to the best frontier node, one node per tick, before searching
+// again. No tick expands more than `lookahead` nodes, whatever the distance to the goal
+class RealTimeAgent
+{
+public:
+    RealTimeAgent(std::vector<std::vector<Node>> &grid, LearnedHeuristic &heuristic, const Position &start, const Position &goal,
+                  int lookahead = 32);
+
+    // Move at most one node, false once the agent has arrived or cannot reach the goal
+    bool tick();
+
+    Position getPosition() const { return Position(cell / cols, cell % cols); }
+    bool hasArrived() const { return cell == goal; }
+    int getMoves() const { return moves; }
+    int getLastExpansions() const { return lastExpansions; }
+
+private:
+    // Lookahead search and learning, fills route; false if no node around can be reached
+    bool search();
+
+    bool isWalkable(int id) const
+    {
+        return grid[id / cols][id % cols].type != Node::NodeType::Wall;
+    }
+
+    std::vector<std::vector<Node>> &grid;
+    LearnedHeuristic &heuristic;
+    const int rows;
+    const int cols;
+    const int lookahead;
+
+    int cell;
+    int goal;
+    std::vector<int> route; // Nodes still to walk, next one last
+    int moves = 0;
+    int lastExpansions = 0;
+    bool stuck = false;
+};
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "SearchArena.h"
+#include <algorithm>
+
+// Arena bound to the calling thread with a Binding, if any
+static thread_local SearchArena *boundArena = nullptr;
+
+SearchArena &SearchArena::current()
+{
+    if (boundArena)
+    {
+        return *boundArena;
+    }
+    static thread_local SearchArena threadArena;
+    return threadArena;
+}
+
+std::pmr::memory_resource *SearchArena::activeResource()
+{
+    SearchArena &arena = current();
+    return arena.depth > 0 ? &arena.counting : std::pmr::get_default_resource();
+}
+
+SearchArena::Binding::Binding(SearchArena &arena) : previous(boundArena)
+{
+    boundArena = &arena;
+}
+
+SearchArena::Binding::~Binding()
+{
+    boundArena = previous;
+}
+
+void SearchArena::begin()
+{
+    if (depth++ > 0)
+    {
+        return;
+    }
+
+    if (!monotonic)
+    {
+        if (capacity > 0)
+            monotonic.emplace(buffer.get(), capacity, std::pmr::new_delete_resource());
+        else
+            monotonic.emplace(std::pmr::new_delete_resource());
+    }
+    counting.upstream = &*monotonic;
+    counting.bytes = 0;
+}
+
+void SearchArena::end()
+{
+    if (--depth > 0)
+    {
+        return;
+    }
+
+    lastBytes = counting.bytes;
+    highWater = std::max(highWater, lastBytes);
+    monotonic->release();
+
+    // Grow the buffer so the next search this large fits in it, with some room for alignment
+    if (lastBytes > capacity)
+    {
+        ++overflows;
+        monotonic.reset();
+        capacity = highWater + highWater / 8 + 4096;
+        buffer.reset(new std::byte[capacity]);
+    }
+}
+
+void SearchArena::trim()
+{
+    if (depth > 0)
+    {
+        return;
+    }
+    monotonic.reset();
+    buffer.reset();
+    capacity = 0;
+}
\ No newline at end of file
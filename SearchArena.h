@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+// Memory for the scratch data of one search at a time: open list, scores and closed flags
+// Allocations are carved out of one buffer (std::pmr::monotonic_buffer_resource) and all of
+// them are released at once when the search ends. The buffer is kept and grown to the largest
+// search seen, so after the first few queries a search makes no call to the global heap and
+// concurrent searches on different arenas never contend for the allocator
+// An arena is used by one thread at a time: each thread has its own, or binds one with Binding
+class SearchArena
+{
+public:
+    SearchArena() = default;
+    SearchArena(const SearchArena &) = delete;
+    SearchArena &operator=(const SearchArena &) = delete;
+
+    // The arena bound to the calling thread, or the thread's own one
+    static SearchArena &current();
+
+    // The memory of the scope open on current(), or the global heap when no scope is open
+    static std::pmr::memory_resource *activeResource();
+
+    // One search: the resource hands out memory until the scope ends, then it is all released
+    // Nested scopes share the memory of the outermost one
+    class Scope
+    {
+    public:
+        explicit Scope(SearchArena &arena = current()) : arena(arena) { arena.begin(); }
+        ~Scope() { arena.end(); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        std::pmr::memory_resource *resource() { return &arena.counting; }
+
+    private:
+        SearchArena &arena;
+    };
+
+    // Make an arena current() for the calling thread until the binding ends, e.g. one arena per
+    // worker of a pool that outlives its threads
+    class Binding
+    {
+    public:
+        explicit Binding(SearchArena &arena);
+        ~Binding();
+
+        Binding(const Binding &) = delete;
+        Binding &operator=(const Binding &) = delete;
+
+    private:
+        SearchArena *previous;
+    };
+
+    // Bytes taken by the last search, and by the largest search so far
+    size_t getLastBytes() const { return lastBytes; }
+    size_t getHighWater() const { return highWater; }
+
+    // Size of the buffer kept between searches
+    size_t getCapacity() const { return capacity; }
+
+    // Searches that needed more than the buffer and went to the global heap
+    long long getOverflows() const { return overflows; }
+
+    // Free the buffer kept between searches, the next search starts from an empty arena
+    void trim();
+
+private:
+    // Counts the bytes a search takes from the buffer
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        std::pmr::memory_resource *upstream = nullptr;
+        size_t bytes = 0;
+
+    private:
+        void *do_allocate(size_t size, size_t alignment) override
+        {
+            bytes += size;
+            return upstream->allocate(size, alignment);
+        }
+
+        void do_deallocate(void *pointer, size_t size, size_t alignment) override
+        {
+            upstream->deallocate(pointer, size, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    void begin();
+    void end();
+
+    std::unique_ptr<std::byte[]> buffer;
+    size_t capacity = 0;
+    std::optional<std::pmr::monotonic_buffer_resource> monotonic;
+    CountingResource counting;
+    int depth = 0;
+
+    size_t lastBytes = 0;
+    size_t highWater = 0;
+    long long overflows = 0;
+};
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "GridLayout.h"
+#include "Clearance.h"
+#include "Map.h"
+
+// Compact copy of a grid for the searches: one clearance byte per cell (0 for walls, see
+// Clearance.h) stored in the order of a GridLayout, instead of the nodes with their shapes and
+// sprites. Searches given a SearchGrid read only this, so a whole 4096 x 4096 map is 16 MB
+// Built from nodes, it mirrors them; call update() after each wall edit, once the clearance
+// layer has been updated, and build() after the grid is replaced or resized
+// Built from a wall test instead, such as MapFile::isWall, it has no nodes at all: it computes
+// the clearance itself and setWall() edits it
+template <typename Layout>
+class BasicSearchGrid
+{
+public:
+    BasicSearchGrid() : layout(0, 0) {}
+
+    explicit BasicSearchGrid(const std::vector<std::vector<Node>> &grid) : grid(&grid), layout(0, 0)
+    {
+        build();
+    }
+
+    template <typename IsWall>
+    BasicSearchGrid(int rows, int cols, const IsWall &isWall) : layout(rows, cols)
+    {
+        clearance.assign(layout.size(), 0);
+        for (int row = rows - 1; row >= 0; --row)
+        {
+            for (int col = cols - 1; col >= 0; --col)
+            {
+                clearance[layout.index(row, col)] = cellClearance(isWall(row, col), row, col, rows, cols, clearanceAt());
+            }
+        }
+    }
+
+    void build()
+    {
+        layout = Layout(grid->size(), grid->empty() ? 0 : (*grid)[0].size());
+        clearance.assign(layout.size(), 0);
+        for (int row = 0; row < layout.rows; ++row)
+        {
+            for (int col = 0; col < layout.cols; ++col)
+            {
+                clearance[layout.index(row, col)] = (*grid)[row][col].clearance;
+            }
+        }
+    }
+
+    // A wall edit only changes the clearance of the same nodes updateClearance() recomputes
+    void update(int row, int col)
+    {
+        for (int y = std::max(row - MAX_CLEARANCE + 1, 0); y <= row; ++y)
+        {
+            for (int x = std::max(col - MAX_CLEARANCE + 1, 0); x <= col; ++x)
+            {
+                clearance[layout.index(y, x)] = (*grid)[y][x].clearance;
+            }
+        }
+    }
+
+    // Add or remove a wall of a grid without nodes, recomputing the clearance around it the
+    // way updateClearance() does; every other cell is a wall if its clearance is 0
+    void setWall(int row, int col, bool wall)
+    {
+        for (int y = row; y >= std::max(row - MAX_CLEARANCE + 1, 0); --y)
+        {
+            for (int x = col; x >= std::max(col - MAX_CLEARANCE + 1, 0); --x)
+            {
+                bool isWall = y == row && x == col ? wall : clearance[layout.index(y, x)] == 0;
+                clearance[layout.index(y, x)] = cellClearance(isWall, y, x, layout.rows, layout.cols, clearanceAt());
+            }
+        }
+    }
+
+    bool isWall(int row, int col) const
+    {
+        return clearance[layout.index(row, col)] == 0;
+    }
+
+    bool isWalkable(int id, int agentSize) const
+    {
+        return clearance[id] >= agentSize;
+    }
+
+    const Layout &getLayout() const
+    {
+        return layout;
+    }
+
+    // The nodes it mirrors, only for a grid built from nodes
+    const std::vector<std::vector<Node>> &getGrid() const
+    {
+        return *grid;
+    }
+
+private:
+    auto clearanceAt() const
+    {
+        return [this](int row, int col) { return int(clearance[layout.index(row, col)]); };
+    }
+
+    const std::vector<std::vector<Node>> *grid = nullptr;
+    Layout layout;
+    std::vector<uint8_t> clearance;
+};
+
+using SearchGrid = BasicSearchGrid<CellLayout>;
\ No newline at end of file
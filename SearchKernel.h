@@ -0,0 +1,298 @@
+#pragma once
+#include "Pathfinder.h"
+#include "IndexedHeap.h"
+#include "SearchArena.h"
+
+// Generic grid search shared by BFS, DFS, Dijkstra and A*
+// Each algorithm is an instantiation of searchKernel with a set of policies, all of them
+// resolved at compile time so the inner loop has no virtual calls or runtime branching:
+//   OpenList  - order in which nodes are expanded (queue, stack or priority queue)
+//   Heuristic - estimate of the remaining cost, added to the G score to get the key
+//   Neighbors - which cells are adjacent to a node
+//   Cost      - cost of moving between two adjacent cells
+//   EarlyExit - whether an end node ends the search when generated or when expanded
+//   Tracer    - records the search events when a SearchTrace is attached, or nothing
+// The scratch memory of a search (open list, scores, closed flags, parents) comes from the
+// thread's SearchArena and is released in one step when the search ends
+// The grid itself is read through a view, either the nodes (NodeGridView) or the compact
+// SearchGrid given to the Pathfinder (SearchGridView), and cells are named by the view's ids
+
+// First-In-First-Out open list, a node is pushed only the first time it is reached
+struct FifoOpenList
+{
+    static constexpr bool reopens = false;
+
+    std::queue<int, std::pmr::deque<int>> q;
+
+    FifoOpenList(int, std::pmr::memory_resource *resource) : q(std::pmr::deque<int>(resource)) {}
+
+    bool empty() const { return q.empty(); }
+    void push(int id, float, int) { q.push(id); }
+    int pop()
+    {
+        int id = q.front();
+        q.pop();
+        return id;
+    }
+};
+
+// Last-In-First-Out open list, a node is pushed only the first time it is reached
+struct LifoOpenList
+{
+    static constexpr bool reopens = false;
+
+    std::stack<int, std::pmr::vector<int>> s;
+
+    LifoOpenList(int, std::pmr::memory_resource *resource) : s(std::pmr::vector<int>(resource)) {}
+
+    bool empty() const { return s.empty(); }
+    void push(int id, float, int) { s.push(id); }
+    int pop()
+    {
+        int id = s.top();
+        s.pop();
+        return id;
+    }
+};
+
+// Smallest F score first, ties broken towards the larger G score (the node closer to the goal)
+// so equal-F plateaus are crossed instead of expanded breadth-first
+struct SearchKey
+{
+    float f;
+    int g;
+
+    bool operator<(const SearchKey &other) const
+    {
+        return f < other.f || (f == other.f && g > other.g);
+    }
+};
+
+// Indexed 4-ary heap, a node whose G score improves has its key decreased in place
+struct PriorityOpenList
+{
+    static constexpr bool reopens = true;
+
+    IndexedHeap<SearchKey, 4> heap;
+
+    PriorityOpenList(int capacity, std::pmr::memory_resource *resource) : heap(capacity, resource) {}
+
+    bool empty() const { return heap.empty(); }
+    void push(int id, float f, int g) { heap.push(id, SearchKey{f, g}); }
+    int pop() { return heap.pop(); }
+};
+
+struct ZeroHeuristic
+{
+    float operator()(Pathfinder &, int, int) const { return 0.0f; }
+};
+
+// Manhattan distance to the nearest end node, optionally inflated by a weight
+// Constant time for any number of end nodes, see GoalSet
+struct NearestGoalHeuristic
+{
+    float weight = 1.0f;
+
+    float operator()(Pathfinder &pathfinder, int row, int col) const { return weight * pathfinder.goalHeuristic(row, col); }
+};
+
+// The nodes of the grid, row-major ids and the walkability rules of Pathfinder::isWalkable
+struct NodeGridView
+{
+    const Pathfinder &pathfinder;
+    RowMajorLayout layout;
+
+    explicit NodeGridView(const Pathfinder &pathfinder) : pathfinder(pathfinder), layout(pathfinder.rows, pathfinder.cols) {}
+
+    const RowMajorLayout &getLayout() const { return layout; }
+    bool isWalkable(int id) const { return pathfinder.isWalkable(id / layout.cols, id % layout.cols); }
+};
+
+// A SearchGrid in any cell layout, only its clearance bytes are read
+template <typename Layout>
+struct SearchGridView
+{
+    const BasicSearchGrid<Layout> &searchGrid;
+    int agentSize;
+
+    const Layout &getLayout() const { return searchGrid.getLayout(); }
+    bool isWalkable(int id) const { return searchGrid.isWalkable(id, agentSize); }
+};
+
+// Up, down, left and right, stepped by the cell layout of the view
+struct FourConnected
+{
+    template <typename View, typename Visit>
+    void operator()(const View &view, int id, Visit &&visit) const
+    {
+        view.getLayout().forEachNeighbor(id, visit);
+    }
+};
+
+struct UnitCost
+{
+    int operator()(int, int) const { return 1; }
+};
+
+// The search ends as soon as an end node is generated (BFS, DFS, Dijkstra with unit costs)
+struct ExitOnGenerate
+{
+    static constexpr bool onGenerate = true;
+};
+
+// The search ends when an end node is taken from the open list (A*)
+struct ExitOnExpand
+{
+    static constexpr bool onGenerate = false;
+};
+
+// Records nothing, a search without trace pays nothing for visualization
+struct NoTrace
+{
+    void operator()(SearchTrace::Event, int) const {}
+};
+
+struct TraceRecorder
+{
+    SearchTrace *trace;
+
+    void operator()(SearchTrace::Event event, int id) const { trace->record(event, id); }
+};
+
+// Run the search from the start node to the nearest end node
+// The path is stored in pathfinder.pathPositions; the grid is only read
+template <typename OpenList, typename Heuristic, typename Neighbors, typename Cost, typename EarlyExit, typename View, typename Tracer>
+bool searchKernelOn(Pathfinder &pathfinder, const View &view, const Heuristic &heuristic, const Neighbors &neighbors, const Cost &cost,
+                  const Tracer &tracer)
+{
+    if (pathfinder.startRow < 0 || pathfinder.endNodes.empty())
+    {
+        return false;
+    }
+
+    const auto &layout = view.getLayout();
+    const int cells = layout.size();
+
+    // Trace events always name cells by their row-major id, whatever the layout
+    auto record = [&](SearchTrace::Event event, int id) { tracer(event, layout.row(id) * layout.cols + layout.col(id)); };
+
+    // Declared before the containers, so the arena outlives everything allocated from it
+    SearchArena::Scope arena;
+    std::pmr::memory_resource *resource = arena.resource();
+
+    // One bit per cell marks the end nodes, so the end test costs the same for any number of goals
+    GoalSet ends(resource);
+    ends.markCells(pathfinder.endNodes, cells, [&](int row, int col) { return layout.index(row, col); });
+    auto isEnd = [&](int id) { return ends.contains(id); };
+
+    OpenList openList(cells, resource);
+    std::pmr::vector<int> gScore(cells, INT_MAX, resource);
+    std::pmr::vector<char> closed(OpenList::reopens ? cells : 0, 0, resource);
+    std::pmr::vector<int> parents(cells, -1, resource); // By cell id of the view
+
+    int startId = layout.index(pathfinder.startRow, pathfinder.startCol);
+
+    // Same as Pathfinder::obtainPath, but following the parents by cell id
+    auto finish = [&](int id)
+    {
+        pathfinder.endRow = layout.row(id);
+        pathfinder.endCol = layout.col(id);
+        for (; id != startId; id = parents[id])
+        {
+            pathfinder.pathPositions.emplace_back(layout.row(id), layout.col(id));
+        }
+        pathfinder.pathPositions.emplace_back(pathfinder.startRow, pathfinder.startCol);
+        std::reverse(pathfinder.pathPositions.begin(), pathfinder.pathPositions.end());
+        return true;
+    };
+
+    gScore[startId] = 0;
+    openList.push(startId, heuristic(pathfinder, pathfinder.startRow, pathfinder.startCol), 0);
+    record(SearchTrace::Event::Push, startId);
+
+    while (!openList.empty())
+    {
+        int id = openList.pop();
+
+        if constexpr (OpenList::reopens)
+        {
+            closed[id] = 1;
+        }
+
+        if constexpr (!EarlyExit::onGenerate)
+        {
+            if (isEnd(id))
+            {
+                return finish(id);
+            }
+        }
+        record(SearchTrace::Event::Expand, id);
+
+        bool found = false;
+        neighbors(view, id, [&](int adjId)
+        {
+            if (found || !view.isWalkable(adjId))
+            {
+                return;
+            }
+
+            int tentativeGScore = gScore[id] + cost(id, adjId);
+
+            // Expanded nodes are never reopened, with a consistent heuristic they can't improve
+            bool improves = OpenList::reopens ? !closed[adjId] && tentativeGScore < gScore[adjId] : gScore[adjId] == INT_MAX;
+            if (!improves)
+            {
+                return;
+            }
+
+            // Store parent node
+            gScore[adjId] = tentativeGScore;
+            parents[adjId] = id;
+
+            if constexpr (EarlyExit::onGenerate)
+            {
+                if (isEnd(adjId))
+                {
+                    found = finish(adjId);
+                    return;
+                }
+            }
+
+            openList.push(adjId, tentativeGScore + heuristic(pathfinder, layout.row(adjId), layout.col(adjId)), tentativeGScore);
+            record(SearchTrace::Event::Push, adjId);
+        });
+
+        if (found)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Search any view, e.g. a SearchGrid in another layout than CellLayout
+// Pick the tracing instantiation once per search, outside the inner loop
+template <typename OpenList, typename Heuristic, typename Neighbors, typename Cost, typename EarlyExit, typename View>
+bool searchKernelOn(Pathfinder &pathfinder, const View &view, const Heuristic &heuristic = Heuristic(), const Neighbors &neighbors = Neighbors(),
+                  const Cost &cost = Cost())
+{
+    if (pathfinder.trace)
+    {
+        pathfinder.trace->cols = pathfinder.cols;
+        return searchKernelOn<OpenList, Heuristic, Neighbors, Cost, EarlyExit>(pathfinder, view, heuristic, neighbors, cost, TraceRecorder{pathfinder.trace});
+    }
+    return searchKernelOn<OpenList, Heuristic, Neighbors, Cost, EarlyExit>(pathfinder, view, heuristic, neighbors, cost, NoTrace());
+}
+
+// Search the Pathfinder's SearchGrid when it has one, its nodes otherwise
+template <typename OpenList, typename Heuristic, typename Neighbors, typename Cost, typename EarlyExit>
+bool searchKernel(Pathfinder &pathfinder, const Heuristic &heuristic = Heuristic(), const Neighbors &neighbors = Neighbors(), const Cost &cost = Cost())
+{
+    if (pathfinder.searchGrid)
+    {
+        SearchGridView<CellLayout> view{*pathfinder.searchGrid, pathfinder.agentSize};
+        return searchKernelOn<OpenList, Heuristic, Neighbors, Cost, EarlyExit>(pathfinder, view, heuristic, neighbors, cost);
+    }
+    return searchKernelOn<OpenList, Heuristic, Neighbors, Cost, EarlyExit>(pathfinder, NodeGridView(pathfinder), heuristic, neighbors, cost);
+}
\ No newline at end of file
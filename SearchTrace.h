@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+// Compact log of what a search did, so the renderer can replay it at any speed
+// without the search writing into the grid that is drawn
+// Each event is 32 bits: the event type in the top 2 bits and the cell id (row * cols + col) below
+struct SearchTrace
+{
+    enum class Event : uint32_t
+    {
+        Push = 0,   // Node added to the open list
+        Expand = 1, // Node taken from the open list and expanded
+        Path = 2    // Node of the final path, from start to end
+    };
+
+    int cols = 0;
+    std::vector<uint32_t> events;
+
+    void clear()
+    {
+        events.clear();
+    }
+
+    void record(Event event, int id)
+    {
+        events.push_back(static_cast<uint32_t>(event) << 30 | static_cast<uint32_t>(id));
+    }
+
+    static Event eventOf(uint32_t entry)
+    {
+        return static_cast<Event>(entry >> 30);
+    }
+
+    static int cellOf(uint32_t entry)
+    {
+        return entry & 0x3FFFFFFFu;
+    }
+};
\ No newline at end of file
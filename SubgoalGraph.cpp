@@ -0,0 +1,438 @@
+#include "SubgoalGraph.h"
+#include "Pathfinder.h"
+#include <queue>
+#include <tuple>
+#include <cstdlib>
+
+void SubgoalGraph::build()
+{
+    if (grid)
+    {
+        rows = grid->size();
+        cols = rows > 0 ? (*grid)[0].size() : 0;
+    }
+    else
+    {
+        rows = searchGrid->getLayout().rows;
+        cols = searchGrid->getLayout().cols;
+    }
+
+    subgoal.assign(rows * cols, 0);
+    edges.clear();
+
+    for (int row = 0; row < rows; ++row)
+    {
+        for (int col = 0; col < cols; ++col)
+        {
+            if (isCorner(row, col))
+            {
+                subgoal[row * cols + col] = 1;
+                edges[row * cols + col];
+            }
+        }
+    }
+
+    for (auto &entry : edges)
+    {
+        exploreDirect(entry.first, nullptr, entry.second);
+    }
+}
+
+size_t SubgoalGraph::getEdgeCount() const
+{
+    size_t count = 0;
+    for (const auto &entry : edges)
+    {
+        count += entry.second.size();
+    }
+    return count / 2;
+}
+
+bool SubgoalGraph::isFree(int row, int col) const
+{
+    if (row < 0 || row >= rows || col < 0 || col >= cols)
+    {
+        return false;
+    }
+    return grid ? (*grid)[row][col].type != Node::NodeType::Wall : !searchGrid->isWall(row, col);
+}
+
+bool SubgoalGraph::isCorner(int row, int col) const
+{
+    if (!isFree(row, col))
+    {
+        return false;
+    }
+
+    for (int dRow = -1; dRow <= 1; dRow += 2)
+    {
+        for (int dCol = -1; dCol <= 1; dCol += 2)
+        {
+            if (!isFree(row + dRow, col + dCol) && isFree(row + dRow, col) && isFree(row, col + dCol))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SubgoalGraph::exploreDirect(int cell, const GoalSet *extraStops, std::vector<int> &found) const
+{
+    const int startRow = cell / cols;
+    const int startCol = cell % cols;
+    const size_t firstFound = found.size();
+
+    auto isStop = [&](int id)
+    {
+        return subgoal[id] || (extraStops && extraStops->contains(id));
+    };
+
+    // Row by row away from the start, every node is entered from the previous row or from the
+    // previous node of its row; 0 not reached, 1 reached, 2 reached but a stop
+    for (int dRow = -1; dRow <= 1; dRow += 2)
+    {
+        for (int dCol = -1; dCol <= 1; dCol += 2)
+        {
+            const int width = dCol > 0 ? cols - startCol : startCol + 1;
+            std::vector<char> previous(width, 0);
+            std::vector<char> current(width, 0);
+            int previousEnd = -1; // Nodes of the previous row after this one were not reached
+
+            for (int i = 0; startRow + i * dRow >= 0 && startRow + i * dRow < rows; ++i)
+            {
+                const int row = startRow + i * dRow;
+                int currentEnd = -1;
+                bool open = false;
+
+                for (int j = 0; j < width; ++j)
+                {
+                    const int col = startCol + j * dCol;
+                    bool reached;
+                    if (i == 0 && j == 0)
+                    {
+                        reached = true;
+                    }
+                    else
+                    {
+                        bool fromPrevious = i > 0 && j <= previousEnd && previous[j] == 1;
+                        bool fromLeft = j > 0 && current[j - 1] == 1;
+                        reached = (fromPrevious || fromLeft) && isFree(row, col);
+                    }
+
+                    currentEnd = j;
+                    if (!reached)
+                    {
+                        current[j] = 0;
+                        // Past the previous row's reach, only the node before could lead further
+                        if (j >= previousEnd)
+                            break;
+                        continue;
+                    }
+
+                    int id = row * cols + col;
+                    if (!(i == 0 && j == 0) && isStop(id))
+                    {
+                        found.push_back(id);
+                        current[j] = 2;
+                    }
+                    else
+                    {
+                        current[j] = 1;
+                        open = true;
+                    }
+                }
+
+                if (!open)
+                    break;
+
+                std::swap(previous, current);
+                previousEnd = currentEnd;
+            }
+        }
+    }
+
+    // Nodes on the row and column of the start are seen from two quadrants
+    std::sort(found.begin() + firstFound, found.end());
+    found.erase(std::unique(found.begin() + firstFound, found.end()), found.end());
+}
+
+void SubgoalGraph::disconnect(int cell)
+{
+    auto entry = edges.find(cell);
+    if (entry == edges.end())
+    {
+        return;
+    }
+
+    for (int other : entry->second)
+    {
+        auto &list = edges[other];
+        list.erase(std::remove(list.begin(), list.end(), cell), list.end());
+    }
+    entry->second.clear();
+}
+
+void SubgoalGraph::connect(int cell)
+{
+    disconnect(cell);
+
+    std::vector<int> &list = edges[cell];
+    exploreDirect(cell, nullptr, list);
+
+    for (int other : list)
+    {
+        auto &otherList = edges[other];
+        if (std::find(otherList.begin(), otherList.end(), cell) == otherList.end())
+        {
+            otherList.push_back(cell);
+        }
+    }
+}
+
+void SubgoalGraph::update(int row, int col)
+{
+    // Only the nodes around the edit can gain or lose their corner
+    for (int r = row - 1; r <= row + 1; ++r)
+    {
+        for (int c = col - 1; c <= col + 1; ++c)
+        {
+            if (r < 0 || r >= rows || c < 0 || c >= cols)
+                continue;
+
+            int id = r * cols + c;
+            bool corner = isCorner(r, c);
+            if (corner && !subgoal[id])
+            {
+                subgoal[id] = 1;
+                edges[id];
+            }
+            else if (!corner && subgoal[id])
+            {
+                disconnect(id);
+                edges.erase(id);
+                subgoal[id] = 0;
+            }
+        }
+    }
+
+    // An edge can only appear or vanish if one of its direct paths goes through the edited node
+    // or a node whose corner changed; both ends of such an edge reach that node directly
+    std::vector<int> affected;
+    for (int r = row - 1; r <= row + 1; ++r)
+    {
+        for (int c = col - 1; c <= col + 1; ++c)
+        {
+            if (r < 0 || r >= rows || c < 0 || c >= cols)
+                continue;
+
+            int id = r * cols + c;
+            if (subgoal[id])
+                affected.push_back(id);
+            exploreDirect(id, nullptr, affected);
+        }
+    }
+
+    std::sort(affected.begin(), affected.end());
+    affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+
+    for (int id : affected)
+    {
+        connect(id);
+    }
+}
+
+std::pmr::vector<std::pair<int, int>> SubgoalGraph::findPath(const Position &start, const std::vector<Position> &ends, int *expansions,
+                                                             SearchTrace *trace) const
+{
+    // Taken before the search opens its own scope, so the path outlives the search
+    std::pmr::vector<std::pair<int, int>> path(SearchArena::activeResource());
+    if (expansions)
+    {
+        *expansions = 0;
+    }
+
+    std::vector<int> goals;
+    std::vector<Position> freeEnds;
+    for (const Position &end : ends)
+    {
+        if (isFree(end.row, end.col))
+        {
+            goals.push_back(end.row * cols + end.col);
+            freeEnds.push_back(end);
+        }
+    }
+    if (!isFree(start.row, start.col) || goals.empty())
+    {
+        return path;
+    }
+
+    SearchArena::Scope arena;
+    std::pmr::memory_resource *resource = arena.resource();
+
+    // The goal test and the heuristic cost the same for any number of goals
+    GoalSet goalSet(resource);
+    goalSet.markCells(freeEnds, rows * cols, [this](int row, int col) { return row * cols + col; });
+    goalSet.buildDistances(freeEnds, rows, cols);
+
+    const int startCell = start.row * cols + start.col;
+    if (trace)
+    {
+        trace->cols = cols;
+    }
+
+    // The start and the goals are linked into the graph like temporary subgoals
+    std::vector<int> fromStart;
+    exploreDirect(startCell, &goalSet, fromStart);
+
+    std::unordered_map<int, std::vector<int>> toGoal;
+    for (int goal : goals)
+    {
+        std::vector<int> found;
+        exploreDirect(goal, nullptr, found);
+        for (int id : found)
+        {
+            toGoal[id].push_back(goal);
+        }
+    }
+
+    auto manhattan = [&](int a, int b)
+    {
+        return std::abs(a / cols - b / cols) + std::abs(a % cols - b % cols);
+    };
+
+    auto heuristic = [&](int id) { return goalSet.manhattan(id / cols, id % cols); };
+
+    std::pmr::vector<int> gScore(rows * cols, INT_MAX, resource);
+    std::pmr::vector<int> parent(rows * cols, -1, resource);
+
+    // (f, -g, node), ties go to the node closer to the goal
+    typedef std::tuple<int, int, int> Entry;
+    std::priority_queue<Entry, std::pmr::vector<Entry>, std::greater<Entry>> open{std::greater<Entry>(), std::pmr::vector<Entry>(resource)};
+
+    gScore[startCell] = 0;
+    parent[startCell] = startCell;
+    open.push(Entry(heuristic(startCell), 0, startCell));
+
+    int reached = -1;
+    while (!open.empty())
+    {
+        auto [f, negG, id] = open.top();
+        open.pop();
+        if (-negG != gScore[id])
+            continue;
+
+        if (goalSet.contains(id))
+        {
+            reached = id;
+            break;
+        }
+
+        if (expansions)
+        {
+            ++*expansions;
+        }
+        if (trace)
+        {
+            trace->record(SearchTrace::Event::Expand, id);
+        }
+
+        auto relax = [&](int next)
+        {
+            int g = -negG + manhattan(id, next);
+            if (g < gScore[next])
+            {
+                gScore[next] = g;
+                parent[next] = id;
+                open.push(Entry(g + heuristic(next), -g, next));
+            }
+        };
+
+        if (id == startCell)
+        {
+            for (int next : fromStart)
+                relax(next);
+        }
+        else
+        {
+            auto entry = edges.find(id);
+            if (entry != edges.end())
+            {
+                for (int next : entry->second)
+                    relax(next);
+            }
+        }
+
+        auto goalEntry = toGoal.find(id);
+        if (goalEntry != toGoal.end())
+        {
+            for (int next : goalEntry->second)
+                relax(next);
+        }
+    }
+
+    if (reached == -1)
+    {
+        return path;
+    }
+
+    std::vector<int> corners;
+    for (int id = reached; id != startCell; id = parent[id])
+    {
+        corners.push_back(id);
+    }
+    corners.push_back(startCell);
+    std::reverse(corners.begin(), corners.end());
+
+    path.emplace_back(start.row, start.col);
+    for (size_t i = 1; i < corners.size(); ++i)
+    {
+        appendSegment(corners[i - 1], corners[i], path);
+    }
+
+    if (trace)
+    {
+        for (const auto &node : path)
+        {
+            trace->record(SearchTrace::Event::Path, node.first * cols + node.second);
+        }
+    }
+    return path;
+}
+
+void SubgoalGraph::appendSegment(int from, int to, std::pmr::vector<std::pair<int, int>> &path) const
+{
+    const int fromRow = from / cols;
+    const int fromCol = from % cols;
+    const int height = std::abs(to / cols - fromRow) + 1;
+    const int width = std::abs(to % cols - fromCol) + 1;
+    const int dRow = to / cols >= fromRow ? 1 : -1;
+    const int dCol = to % cols >= fromCol ? 1 : -1;
+
+    // Nodes of the bounding box from which `to` can still be reached monotonically
+    std::vector<char> reaches(height * width, 0);
+    for (int i = height - 1; i >= 0; --i)
+    {
+        for (int j = width - 1; j >= 0; --j)
+        {
+            if (!isFree(fromRow + i * dRow, fromCol + j * dCol))
+                continue;
+
+            bool last = i == height - 1 && j == width - 1;
+            bool down = i + 1 < height && reaches[(i + 1) * width + j];
+            bool across = j + 1 < width && reaches[i * width + j + 1];
+            reaches[i * width + j] = last || down || across;
+        }
+    }
+
+    int i = 0;
+    int j = 0;
+    while (i != height - 1 || j != width - 1)
+    {
+        if (i + 1 < height && reaches[(i + 1) * width + j])
+            ++i;
+        else
+            ++j;
+        path.emplace_back(fromRow + i * dRow, fromCol + j * dCol);
+    }
+}
\ No newline at end of file
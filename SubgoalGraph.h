@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <memory_resource>
+#include "GridLayout.h"
+
+struct Node;
+struct Position;
+class GoalSet;
+struct SearchTrace;
+template <typename Layout>
+class BasicSearchGrid;
+
+// Simple subgoal graph for the 4-connected grid
+// Subgoals are the free nodes at convex wall corners: a diagonal neighbour is a wall while the
+// two nodes next to both of them are free. Two subgoals are joined when one can reach the other
+// with a Manhattan-length (monotone) path that passes no other subgoal, found by a monotone
+// exploration of the four quadrants around each subgoal
+// A query links the start and the goals into the graph the same way and runs A* on it only;
+// the segments between subgoals are then filled in, which gives a shortest grid path
+// Searches only read the graph, so several can run at the same time between edits
+class SubgoalGraph
+{
+public:
+    explicit SubgoalGraph(std::vector<std::vector<Node>> &grid) : grid(&grid) { build(); }
+
+    // A graph over the walls of a SearchGrid without nodes, such as the path service's
+    explicit SubgoalGraph(const BasicSearchGrid<CellLayout> &searchGrid) : searchGrid(&searchGrid) { build(); }
+
+    // Rebuild everything, after the grid was replaced or resized
+    void build();
+
+    // Update the subgoals and edges around (row, col) after it became a wall or stopped being one
+    void update(int row, int col);
+
+    // Shortest path from start to the nearest goal as every node on the way, empty if none
+    // expansions receives the number of graph nodes the search expanded; a trace receives the
+    // expanded subgoals and the path
+    // The path comes from the SearchArena scope open on the calling thread, if any, like the
+    // results of a Pathfinder, and the search's own arrays from the thread's arena
+    std::pmr::vector<std::pair<int, int>> findPath(const Position &start, const std::vector<Position> &ends, int *expansions = nullptr,
+                                              SearchTrace *trace = nullptr) const;
+
+    int getSubgoalCount() const { return edges.size(); }
+    size_t getEdgeCount() const;
+
+private:
+    bool isFree(int row, int col) const;
+
+    bool isCorner(int row, int col) const;
+
+    // Nodes reachable from cell by a monotone path in one of the four quadrants, stopping at
+    // subgoals and at the extra stop cells; found receives the stops reached
+    void exploreDirect(int cell, const GoalSet *extraStops, std::vector<int> &found) const;
+
+    // Recompute the edges of a subgoal and mirror them on its neighbours
+    void connect(int cell);
+    void disconnect(int cell);
+
+    // Fill in a monotone path from one node to another, appending all but the first node
+    void appendSegment(int from, int to, std::pmr::vector<std::pair<int, int>> &path) const;
+
+    // Exactly one of them is set
+    std::vector<std::vector<Node>> *grid = nullptr;
+    const BasicSearchGrid<CellLayout> *searchGrid = nullptr;
+    int rows = 0;
+    int cols = 0;
+
+    std::vector<char> subgoal; // Per node
+    std::unordered_map<int, std::vector<int>> edges; // Subgoal -> directly reachable subgoals
+};
\ No newline at end of file
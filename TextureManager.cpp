@@ -0,0 +1,72 @@
+#include "TextureManager.h"
+#include "EmbeddedAssets.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    // Same order as TextureManager::Sheet
+    const EmbeddedAsset *const SHEET_ASSETS[] = {
+        &EmbeddedAssets::UI,
+        &EmbeddedAssets::UI2,
+        &EmbeddedAssets::Cursors,
+        &EmbeddedAssets::Tiles};
+
+    // Width and height from the IHDR chunk, which always directly follows the PNG signature
+    sf::Vector2u pngSize(const EmbeddedAsset &asset)
+    {
+        auto readU32 = [&](int offset)
+        {
+            const unsigned char *p = asset.data + offset;
+            return (unsigned)p[0] << 24 | (unsigned)p[1] << 16 | (unsigned)p[2] << 8 | (unsigned)p[3];
+        };
+        return sf::Vector2u(readU32(16), readU32(20));
+    }
+}
+
+TextureManager::TextureManager()
+{
+    // Sheets go left to right with a transparent column in between, so filtering never bleeds
+    unsigned x = 0;
+    for (int i = 0; i < SHEETS; ++i)
+    {
+        sf::Vector2u size = pngSize(*SHEET_ASSETS[i]);
+        origins[i] = sf::Vector2i(x, 0);
+        x += size.x + 1;
+        atlasSize.y = std::max(atlasSize.y, size.y);
+    }
+    atlasSize.x = x - 1;
+
+    std::array<sf::Vector2i, SHEETS> layout = origins;
+    sf::Vector2u size = atlasSize;
+
+    decoding = std::async(std::launch::async, [layout, size]()
+    {
+        sf::Image image;
+        image.create(size.x, size.y, sf::Color::Transparent);
+
+        for (int i = 0; i < SHEETS; ++i)
+        {
+            sf::Image sheet;
+            if (sheet.loadFromMemory(SHEET_ASSETS[i]->data, SHEET_ASSETS[i]->size))
+                image.copy(sheet, layout[i].x, layout[i].y);
+        }
+        return image;
+    });
+}
+
+bool TextureManager::uploadIfReady()
+{
+    if (loaded || decoding.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    atlas.loadFromImage(decoding.get());
+    loaded = true;
+    return true;
+}
+
+sf::IntRect TextureManager::rect(Sheet sheet, int left, int top, int width, int height) const
+{
+    const sf::Vector2i &origin = origins[static_cast<int>(sheet)];
+    return sf::IntRect(origin.x + left, origin.y + top, width, height);
+}
\ No newline at end of file
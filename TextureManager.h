@@ -1,19 +1,42 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <future>
 
+// All the sprite sheets packed side by side in a single atlas texture, so the whole UI
+// and the dungeon tiles are drawn from one texture
+// The sheets are embedded in the binary and decoded on a worker thread while the window
+// comes up; the atlas layout only needs the PNG headers and is known right away
 class TextureManager
 {
 public:
-    sf::Texture icons_texture;
-    sf::Texture no_icons_texture;
-    sf::Texture cursor_texture;
-    sf::Texture dungeon_texture;
-
-    TextureManager()
+    enum class Sheet
     {
-        icons_texture.loadFromFile("Assets/UI.png");
-        no_icons_texture.loadFromFile("Assets/UI2.png");
-        cursor_texture.loadFromFile("Assets/cursors.png");
-        dungeon_texture.loadFromFile("Assets/tiles_1.png");
-    }
+        Icons,
+        NoIcons,
+        Cursors,
+        Dungeon
+    };
+
+    sf::Texture atlas;
+
+    TextureManager();
+
+    // Upload the decoded atlas once the worker is done, returns true on the call that uploaded it
+    // Textures can only be created on the thread that draws, so this is called from the main loop
+    bool uploadIfReady();
+
+    bool isLoaded() const { return loaded; }
+
+    // Atlas rectangle of a sprite, given by its rectangle in the original sheet
+    sf::IntRect rect(Sheet sheet, int left, int top, int width, int height) const;
+
+private:
+    static const int SHEETS = 4;
+
+    std::array<sf::Vector2i, SHEETS> origins;
+    sf::Vector2u atlasSize;
+
+    std::future<sf::Image> decoding;
+    bool loaded = false;
 };
\ No newline at end of file
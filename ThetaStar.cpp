@@ -0,0 +1,123 @@
+#include "Pathfinder.h"
+#include "IndexedHeap.h"
+#include "Bresenham.h"
+#include <cfloat>
+
+void ThetaStar::searchPath()
+{
+    if (startRow < 0 || endNodes.empty())
+    {
+        return;
+    }
+
+
+    // The scratch memory comes from the thread's arena, see SearchArena.h
+    SearchArena::Scope arena;
+    std::pmr::memory_resource *resource = arena.resource();
+
+    // Keys are (F score, -G score) so ties go to the node closer to the goal
+    IndexedHeap<std::pair<float, float>, 4> openSet(rows * cols, resource);
+    std::pmr::vector<float> gScore(rows * cols, FLT_MAX, resource);
+    std::pmr::vector<char> closed(rows * cols, 0, resource);
+    std::pmr::vector<int> parents(rows * cols, -1, resource);
+
+    auto distance = [](int row1, int col1, int row2, int col2)
+    {
+        return std::sqrt(static_cast<float>((row1 - row2) * (row1 - row2) + (col1 - col2) * (col1 - col2)));
+    };
+
+    // Straight-line distance to the nearest end node, admissible for any-angle paths
+    auto heuristic = [&](int row, int col) { return goalDistance(row, col); };
+
+    gScore[startRow * cols + startCol] = 0.0f;
+    parents[startRow * cols + startCol] = startRow * cols + startCol;
+
+    if (trace)
+    {
+        trace->cols = cols;
+    }
+    openSet.push(startRow * cols + startCol, std::make_pair(heuristic(startRow, startCol), 0.0f));
+
+    while (!openSet.empty())
+    {
+        int id = openSet.pop();
+        Position current(id / cols, id % cols);
+        closed[id] = 1;
+
+        if (isEndNode(current.row, current.col))
+        {
+            endRow = current.row;
+            endCol = current.col;
+
+            // Follow the parents, every one of them is a turning point
+            waypoints.clear();
+            int row = endRow;
+            int col = endCol;
+            while (row != startRow || col != startCol)
+            {
+                waypoints.emplace_back(row, col);
+                int parent = parents[row * cols + col];
+                row = parent / cols;
+                col = parent % cols;
+            }
+            waypoints.emplace_back(startRow, startCol);
+            std::reverse(waypoints.begin(), waypoints.end());
+
+            // Expand the segments into nodes so the path can be drawn
+            pathPositions.clear();
+            pathPositions.push_back(waypoints[0]);
+            for (size_t i = 1; i < waypoints.size(); ++i)
+            {
+                traceLine(waypoints[i - 1].second, waypoints[i - 1].first, waypoints[i].second, waypoints[i].first, [&](int x, int y)
+                {
+                    if (pathPositions.back() != std::make_pair(y, x))
+                    {
+                        pathPositions.emplace_back(y, x);
+                    }
+                    return true;
+                });
+            }
+            return;
+        }
+
+        if (trace)
+        {
+            trace->record(SearchTrace::Event::Expand, id);
+        }
+
+        int parentId = parents[id];
+        std::pair<int, int> parent(parentId / cols, parentId % cols);
+
+        forEachAdjacentNode(current.row, current.col, [&](int row, int col)
+        {
+            int adjId = row * cols + col;
+
+            if (closed[adjId] || !isWalkable(row, col))
+            {
+                return;
+            }
+
+            // Path 2: connect straight to the current node's parent if it can see the neighbor,
+            // otherwise path 1: go through the current node like A*
+            float tentativeGScore;
+            int newParent;
+            if (lineOfSight(parent.first, parent.second, row, col))
+            {
+                tentativeGScore = gScore[parentId] + distance(parent.first, parent.second, row, col);
+                newParent = parentId;
+            }
+            else
+            {
+                tentativeGScore = gScore[id] + 1.0f;
+                newParent = id;
+            }
+
+            if (tentativeGScore < gScore[adjId])
+            {
+                gScore[adjId] = tentativeGScore;
+                parents[adjId] = newParent;
+                openSet.push(adjId, std::make_pair(tentativeGScore + heuristic(row, col), -tentativeGScore));
+            }
+        });
+    }
+}
\ No newline at end of file
@@ -1,111 +1,461 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include <chrono>
+#include <cstdio>
 #include "Map.h"
 #include "Pathfinder.h"
+#include "PathService.h"
+#include "FrameScheduler.h"
+#include "FrameProfiler.h"
+#include "CooperativePlanner.h"
+#include "RealTimeSearch.h"
+#include "SubgoalGraph.h"
+#include "SearchKernel.h"
 
-int main()
+// Headless mode: Pathfinding --service <map.txt | map.pfm> [--socket <path>]
+static int runService(int argc, char *argv[])
 {
+    SearchGrid grid;
+    if (!PathService::loadMap(argv[2], grid))
+    {
+        std::cerr << "Could not load map " << argv[2] << std::endl;
+        return 1;
+    }
+
+    PathService service(std::move(grid));
+    if (argc >= 5 && std::string(argv[3]) == "--socket")
+    {
+        if (!service.runSocket(argv[4]))
+        {
+            std::cerr << "Could not listen on " << argv[4] << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        service.runStdio();
+    }
+    return 0;
+}
+
+// Benchmark: Pathfinding --bench [size] [seed] [agents]
+// Runs every algorithm on a generated map of every style, the same seed gives the same maps,
+// then moves a group of agents across an open field with the cooperative planner
+static int runBench(int argc, char *argv[])
+{
+    int size = argc >= 3 ? std::atoi(argv[2]) : 512;
+    uint64_t seed = argc >= 4 ? std::strtoull(argv[3], nullptr, 10) : 1;
+    int agentCount = argc >= 5 ? std::atoi(argv[4]) : 200;
+    if (size < 2)
+    {
+        std::cerr << "Map size must be at least 2" << std::endl;
+        return 1;
+    }
+
+    std::printf("%dx%d, seed %llu\n", size, size, (unsigned long long)seed);
+    std::printf("%-12s %-12s %10s %8s\n", "map", "algorithm", "ms", "length");
+
+    std::vector<std::vector<Node>> grid(size, std::vector<Node>(size));
+
+    for (int style = 0; style < MAP_STYLE_COUNT; ++style)
+    {
+        generateMap(grid, static_cast<MapStyle>(style), seed);
+
+        // The generators place one Start and one End node
+        Pathfinder flags(grid);
+        Position start(flags.startRow, flags.startCol);
+
+        auto run = [&](const char *name, auto search)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            auto path = search();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            std::printf("%-12s %-12s %10.2f %8d\n", mapStyleName(static_cast<MapStyle>(style)), name, ms, int(path.size()));
+        };
+
+        run("BFS", [&] { return BFS(grid, start, flags.endNodes).pathPositions; });
+        run("DFS", [&] { return DFS(grid, start, flags.endNodes).pathPositions; });
+        run("Dijkstra", [&] { return Dijkstra(grid, start, flags.endNodes).pathPositions; });
+        run("A*", [&] { return Astar(grid, start, flags.endNodes).pathPositions; });
+        run("ParallelBFS", [&] { return ParallelBFS(grid, start, flags.endNodes).pathPositions; });
+
+        auto buildBegin = std::chrono::steady_clock::now();
+        SubgoalGraph graph(grid);
+        double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildBegin).count();
+
+        int graphExpansions = 0;
+        run("Subgoal", [&] { return graph.findPath(start, flags.endNodes, &graphExpansions); });
+        std::printf("%-12s %-12s %10.2f %8s  %d subgoals, %zu edges, %d expanded\n", mapStyleName(static_cast<MapStyle>(style)),
+                    "  build", buildMs, "", graph.getSubgoalCount(), graph.getEdgeCount(), graphExpansions);
+    }
+
+    // Repeated trips of a real-time agent across a rooms map, learning makes them shorter
+    generateMap(grid, MapStyle::Rooms, seed);
+    Pathfinder flags(grid);
+    if (flags.startRow >= 0 && !flags.endNodes.empty())
+    {
+        const int lookahead = 32;
+        LearnedHeuristic learned(size, size);
+        std::printf("\nReal-time agent, %d expansions per tick\n", lookahead);
+
+        for (int trip = 1; trip <= 5; ++trip)
+        {
+            RealTimeAgent agent(grid, learned, Position(flags.startRow, flags.startCol), flags.endNodes[0], lookahead);
+            int worst = 0;
+            auto begin = std::chrono::steady_clock::now();
+            while (agent.tick() && agent.getMoves() < size * size)
+            {
+                worst = std::max(worst, agent.getLastExpansions());
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            std::printf("trip %d: %d moves%s, at most %d expansions per tick, %.2f ms, %zu learned values\n", trip,
+                        agent.getMoves(), agent.hasArrived() ? "" : " (not arrived)", worst, ms, learned.size());
+        }
+    }
+
+    // Random starts and goals on an open field, every agent crosses a good part of the map
+    // Two agents never share a goal, one of them could never arrive
+    generateMap(grid, MapStyle::OpenField, seed);
+    CooperativePlanner planner(grid);
+    MapRandom random(seed);
+    std::vector<char> goalTaken(size * size, 0);
+
+    // Adding the agents also runs their goal searches up to the starts
+    auto setupBegin = std::chrono::steady_clock::now();
+    for (int attempts = 0; planner.getAgentCount() < agentCount && attempts < agentCount * 100; ++attempts)
+    {
+        Position agentStart(random.below(size), random.below(size));
+        Position agentGoal(random.below(size), random.below(size));
+        if (grid[agentGoal.row][agentGoal.col].type != Node::NodeType::Wall && !goalTaken[agentGoal.row * size + agentGoal.col] &&
+            planner.addAgent(agentStart, agentGoal) != -1)
+        {
+            goalTaken[agentGoal.row * size + agentGoal.col] = 1;
+        }
+    }
+    double setupMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - setupBegin).count();
+
+    double totalMs = 0;
+    double worstMs = 0;
+    while (!planner.allArrived() && planner.getTime() < size * 4)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        planner.tick();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+    }
+
+    int arrived = 0;
+    for (int agent = 0; agent < planner.getAgentCount(); ++agent)
+    {
+        arrived += planner.hasArrived(agent);
+    }
+
+    std::printf("\nCooperative planner: %d agents, %d ticks, %d arrived\n", planner.getAgentCount(), planner.getTime(), arrived);
+
+    std::printf("%.3f ms to add the agents, %.3f ms per tick on average, %.3f ms at worst, %lld expansions\n", setupMs,
+                totalMs / std::max(planner.getTime(), 1), worstMs, planner.getExpansions());
+    return 0;
+}
+
+// Benchmark: Pathfinding --layout-bench [size] [seed]
+// Runs the kernel searches on the nodes and on a SearchGrid in each cell layout, on large maps
+// (4096 x 4096 by default) where the layout decides how many steps miss the cache
+static int runLayoutBench(int argc, char *argv[])
+{
+    int size = argc >= 3 ? std::atoi(argv[2]) : 4096;
+    uint64_t seed = argc >= 4 ? std::strtoull(argv[3], nullptr, 10) : 1;
+    if (size < 2 || size > 16384)
+    {
+        std::cerr << "Map size must be between 2 and 16384" << std::endl;
+        return 1;
+    }
+
+    std::printf("%dx%d, seed %llu, SearchGrid uses the %s layout\n", size, size, (unsigned long long)seed, CellLayout::name());
+    std::printf("%-12s %-10s %10s %10s %10s %8s\n", "map", "algorithm", "nodes ms", "row ms", "morton ms", "length");
+
+    std::vector<std::vector<Node>> grid(size, std::vector<Node>(size));
+
+    for (int style = 0; style < MAP_STYLE_COUNT; ++style)
+    {
+        generateMap(grid, static_cast<MapStyle>(style), seed);
+        Pathfinder flags(grid);
+        Position start(flags.startRow, flags.startCol);
+        BasicSearchGrid<RowMajorLayout> rowMajor(grid);
+        BasicSearchGrid<MortonLayout> morton(grid);
+
+        // The same search on the three views, timed separately
+        auto run = [&](const char *name, auto search)
+        {
+            double ms[3];
+            size_t length = 0;
+            for (int view = 0; view < 3; ++view)
+            {
+                Pathfinder pathfinder(grid, start, flags.endNodes);
+                auto begin = std::chrono::steady_clock::now();
+                if (view == 0)
+                    search(pathfinder, NodeGridView(pathfinder));
+                else if (view == 1)
+                    search(pathfinder, SearchGridView<RowMajorLayout>{rowMajor, 1});
+                else
+                    search(pathfinder, SearchGridView<MortonLayout>{morton, 1});
+                ms[view] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+                length = pathfinder.pathPositions.size();
+            }
+            std::printf("%-12s %-10s %10.2f %10.2f %10.2f %8zu\n", mapStyleName(static_cast<MapStyle>(style)), name, ms[0], ms[1], ms[2], length);
+        };
+
+        run("BFS", [](Pathfinder &pathfinder, const auto &view)
+            { searchKernelOn<FifoOpenList, ZeroHeuristic, FourConnected, UnitCost, ExitOnGenerate>(pathfinder, view); });
+        run("Dijkstra", [](Pathfinder &pathfinder, const auto &view)
+            { searchKernelOn<PriorityOpenList, ZeroHeuristic, FourConnected, UnitCost, ExitOnGenerate>(pathfinder, view); });
+        run("A*", [](Pathfinder &pathfinder, const auto &view)
+            { searchKernelOn<PriorityOpenList, NearestGoalHeuristic, FourConnected, UnitCost, ExitOnExpand>(pathfinder, view); });
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc >= 3 && std::string(argv[1]) == "--service")
+    {
+        return runService(argc, argv);
+    }
+
+    if (argc >= 2 && std::string(argv[1]) == "--bench")
+    {
+        return runBench(argc, argv);
+    }
+
+    if (argc >= 2 && std::string(argv[1]) == "--layout-bench")
+    {
+        return runLayoutBench(argc, argv);
+    }
+
     // Initialize the map with grid dimensions and node sizes
     Map map(40, 60, 20, 20);
 
+    // Editor mode: Pathfinding [map.pfm], Ctrl+S saves the map to that file and Ctrl+O reloads it
+    std::string mapPath = argc >= 2 ? argv[1] : "map.pfm";
+    if (argc >= 2 && !map.loadMap(mapPath))
+    {
+        std::cerr << "Could not load map " << mapPath << std::endl;
+    }
+
     sf::RenderWindow window(sf::VideoMode(map.getWindowWidth(), map.getWindowHeight()), "Pathfinding - SFML", sf::Style::Close);
 
-    while (window.isOpen())
+    FrameScheduler scheduler(window);
+    FrameProfiler profiler;
+
+    bool searched = false;
+
+    // The mini-dungeon character takes one step per interval until it reaches the end
+    const sf::Time CHARACTER_STEP = sf::milliseconds(200);
+    sf::Clock characterClock;
+    bool characterArrived = false;
+
+    auto handleEvent = [&](const sf::Event &event)
     {
-        sf::Event event;
-        while (window.pollEvent(event))
+        if (event.type == sf::Event::Closed)
+            window.close();
+        else if (event.type == sf::Event::KeyPressed)
         {
-            if (event.type == sf::Event::Closed)
-                window.close();
-            else if (event.type == sf::Event::MouseButtonPressed)
+            // Up and Down change the replay speed of the search
+            if (event.key.code == sf::Keyboard::Up)
+                map.replaySpeed = std::min(map.replaySpeed * 2, 1 << 20);
+            else if (event.key.code == sf::Keyboard::Down)
+                map.replaySpeed = std::max(map.replaySpeed / 2, 1);
+            // F1 shows the frame time graph
+            else if (event.key.code == sf::Keyboard::F1)
+                profiler.toggle();
+            else if (event.key.control && event.key.code == sf::Keyboard::S)
+            {
+                if (!map.saveMap(mapPath))
+                    std::cerr << "Could not save map " << mapPath << std::endl;
+            }
+            else if (event.key.control && event.key.code == sf::Keyboard::O)
+            {
+                if (!map.loadMap(mapPath))
+                    std::cerr << "Could not load map " << mapPath << std::endl;
+            }
+        }
+        else if (event.type == sf::Event::MouseButtonPressed)
+        {
+            if (event.mouseButton.button == sf::Mouse::Left)
             {
-                if (event.mouseButton.button == sf::Mouse::Left)
-                {
 
-                    if (map.button1.getGlobalBounds().intersects(map.cursor_sprite.getGlobalBounds()) && !map.getStartStatus())
+                if (map.button1.getGlobalBounds().intersects(map.cursor_sprite.getGlobalBounds()) && !map.getStartStatus())
+                {
+                    switch (map.alg_type)
                     {
-                        switch (map.alg_type)
-                        {
-                        case Map::AlgorithmType::BFS:
-                            map.alg_type = Map::AlgorithmType::Astar;
-                            break;
-                        case Map::AlgorithmType::Astar:
-                            map.alg_type = Map::AlgorithmType::Dijkstra;
-                            break;
-                        case Map::AlgorithmType::Dijkstra:
-                            map.alg_type = Map::AlgorithmType::DFS;
-                            break;
-                        case Map::AlgorithmType::DFS:
-                            map.alg_type = Map::AlgorithmType::BFS;
-                            break;
-                        }
+                    case Map::AlgorithmType::BFS:
+                        map.alg_type = Map::AlgorithmType::Subgoal;
+                        break;
+                    case Map::AlgorithmType::Subgoal:
+                        map.alg_type = Map::AlgorithmType::Astar;
+                        break;
+                    case Map::AlgorithmType::Astar:
+                        map.alg_type = Map::AlgorithmType::Dijkstra;
+                        break;
+                    case Map::AlgorithmType::Dijkstra:
+                        map.alg_type = Map::AlgorithmType::DFS;
+                        break;
+                    case Map::AlgorithmType::DFS:
+                        map.alg_type = Map::AlgorithmType::BFS;
+                        break;
                     }
-                    else if (map.button2.getGlobalBounds().intersects(map.cursor_sprite.getGlobalBounds()) && !map.getStartStatus())
+                }
+                else if (map.style_text.getGlobalBounds().contains(map.cursor_sprite.getPosition()) && !map.getStartStatus())
+                {
+                    map.map_style = static_cast<MapStyle>((static_cast<int>(map.map_style) + 1) % MAP_STYLE_COUNT);
+                }
+                else if (map.generate_text.getGlobalBounds().contains(map.cursor_sprite.getPosition()) && !map.getStartStatus())
+                {
+                    map.generate();
+                }
+                else if (map.button2.getGlobalBounds().intersects(map.cursor_sprite.getGlobalBounds()) && !map.getStartStatus())
+                {
+                    switch (map.alg_type)
                     {
-                        switch (map.alg_type)
-                        {
-                        case Map::AlgorithmType::BFS:
-                            map.alg_type = Map::AlgorithmType::DFS;
-                            break;
-                        case Map::AlgorithmType::DFS:
-                            map.alg_type = Map::AlgorithmType::Dijkstra;
-                            break;
-                        case Map::AlgorithmType::Dijkstra:
-                            map.alg_type = Map::AlgorithmType::Astar;
-                            break;
-                        case Map::AlgorithmType::Astar:
-                            map.alg_type = Map::AlgorithmType::BFS;
-                            break;
-                        }
+                    case Map::AlgorithmType::BFS:
+                        map.alg_type = Map::AlgorithmType::DFS;
+                        break;
+                    case Map::AlgorithmType::DFS:
+                        map.alg_type = Map::AlgorithmType::Dijkstra;
+                        break;
+                    case Map::AlgorithmType::Dijkstra:
+                        map.alg_type = Map::AlgorithmType::Astar;
+                        break;
+                    case Map::AlgorithmType::Astar:
+                        map.alg_type = Map::AlgorithmType::Subgoal;
+                        break;
+                    case Map::AlgorithmType::Subgoal:
+                        map.alg_type = Map::AlgorithmType::BFS;
+                        break;
                     }
                 }
             }
         }
+    };
+
+    while (window.isOpen())
+    {
+        sf::Event event;
+
+        // Sleeps here while the editor is idle
+        profiler.begin(FrameProfiler::Section::Idle);
+        bool woken = scheduler.waitEvent(event);
+
+        profiler.begin(FrameProfiler::Section::Input);
+        if (woken)
+            handleEvent(event);
+        while (scheduler.pollEvent(event))
+            handleEvent(event);
 
         // Update Drawing tools
         map.updateTools(window);
 
-        if (map.getStartStatus())
+        if (!map.getStartDungeon())
         {
+            map.updateNodes(window);
+        }
+
+        profiler.begin(FrameProfiler::Section::Search);
+
+        // Run the search once, its trace is then replayed on the grid over the next frames
+        if (map.getStartStatus() && !searched)
+        {
+            map.resetTrace();
+
             if (map.alg_type == Map::AlgorithmType::BFS)
             {
-                BFS bfs(map.grid);
+                BFS bfs(map.grid, 1, &map.searchTrace);
             }
             else if (map.alg_type == Map::AlgorithmType::DFS)
             {
-                DFS dfs(map.grid);
+                DFS dfs(map.grid, 1, &map.searchTrace);
             }
             else if (map.alg_type == Map::AlgorithmType::Dijkstra)
             {
-                Dijkstra dijstra(map.grid);
+                Dijkstra dijstra(map.grid, 1, &map.searchTrace);
+            }
+            else if (map.alg_type == Map::AlgorithmType::Subgoal)
+            {
+                // The graph follows the wall edits, only the query runs here
+                Pathfinder flags(map.grid);
+                if (flags.startRow >= 0)
+                {
+                    map.subgoalGraph.findPath(Position(flags.startRow, flags.startCol), flags.endNodes, nullptr, &map.searchTrace);
+                }
             }
             else
             {
-                Astar astar(map.grid);
+                Astar astar(map.grid, 1.0f, 1, &map.searchTrace);
             }
+
+            searched = true;
+        }
+        else if (!map.getStartStatus())
+        {
+            searched = false;
         }
 
-        if (map.getStartDungeon())
+        profiler.begin(FrameProfiler::Section::Agent);
+
+        if (map.replayTrace())
         {
-            map.moveCharacter(map.grid);
+            scheduler.requestRedraw();
+            scheduler.keepAwake();
         }
 
-        window.clear();
+        if (map.getStartDungeon() && !characterArrived)
+        {
+            scheduler.keepAwake();
 
-        if (!map.getStartDungeon())
+            if (characterClock.getElapsedTime() >= CHARACTER_STEP)
+            {
+                characterClock.restart();
+                characterArrived = !map.moveCharacter(map.grid);
+                scheduler.requestRedraw();
+            }
+        }
+        else if (!map.getStartDungeon())
         {
-            map.updateNodes(window);
-            map.drawGrid(window);
-            map.drawNodes(window, map.grid);
+            characterArrived = false;
         }
-        else
+
+        profiler.begin(FrameProfiler::Section::Draw);
+
+        // The atlas is decoded in the background, frames are drawn without it until it is uploaded
+        if (!map.txtManager.isLoaded())
         {
-            map.dungeonMap(window, map.grid);
+            scheduler.keepAwake();
+            if (map.txtManager.uploadIfReady())
+                scheduler.requestRedraw();
         }
 
-        map.drawMenu(window);
+        if (scheduler.needsRedraw())
+        {
+            window.clear();
+
+            if (!map.getStartDungeon())
+            {
+                map.drawGrid(window);
+                map.drawNodes(window, map.grid);
+            }
+            else
+            {
+                map.dungeonMap(window, map.grid);
+            }
+
+            map.drawMenu(window);
+            profiler.draw(window, map.getFont());
+
+            window.display();
+        }
 
-        window.display();
+        profiler.endFrame();
+        scheduler.endFrame();
     }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdio>
+
+// Minimal checks for the test programs in this directory: a failed check prints where it
+// failed and is counted, and each program returns non-zero if any check failed
+namespace test
+{
+    inline int &failures()
+    {
+        static int count = 0;
+        return count;
+    }
+
+    inline void check(bool passed, const char *condition, const char *file, int line)
+    {
+        if (!passed)
+        {
+            std::printf("%s:%d: CHECK(%s) failed\n", file, line, condition);
+            ++failures();
+        }
+    }
+
+    inline int report(const char *name)
+    {
+        std::printf("%s: %s (%d failed checks)\n", name, failures() ? "FAILED" : "passed", failures());
+        return failures() ? 1 : 0;
+    }
+}
+
+#define CHECK(condition) test::check(bool(condition), #condition, __FILE__, __LINE__)
\ No newline at end of file
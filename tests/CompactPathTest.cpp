@@ -0,0 +1,140 @@
+#include "Check.h"
+#include "../CompactPath.h"
+
+namespace
+{
+    typedef CompactPath::Positions Positions;
+
+    // Encode the cells, then read them back both ways
+    void checkRoundTrip(const Positions &cells)
+    {
+        CompactPath path(cells);
+        CHECK(path.size() == cells.size());
+        CHECK(path.toPositions() == cells);
+
+        Positions streamed(path.begin(), path.end());
+        CHECK(streamed == cells);
+
+        if (!cells.empty())
+        {
+            CHECK(path.front() == cells.front());
+            CHECK(path.back() == cells.back());
+        }
+    }
+
+    void appendRun(Positions &cells, int dRow, int dCol, int steps)
+    {
+        for (int i = 0; i < steps; ++i)
+        {
+            cells.emplace_back(cells.back().first + dRow, cells.back().second + dCol);
+        }
+    }
+
+    void testEmptyAndSingle()
+    {
+        CompactPath empty;
+        CHECK(empty.empty());
+        CHECK(empty.begin() == empty.end());
+        checkRoundTrip({});
+        checkRoundTrip({{5, 7}});
+    }
+
+    // One byte holds at most 63 steps, longer runs take several
+    void testLongRuns()
+    {
+        for (int steps : {1, 62, 63, 64, 126, 127, 200, 1000})
+        {
+            Positions cells = {{500, 500}};
+            appendRun(cells, 0, 1, steps);
+            appendRun(cells, 1, 0, steps);
+            appendRun(cells, 0, -1, steps);
+            appendRun(cells, -1, 0, steps);
+            checkRoundTrip(cells);
+
+            // Four runs of steps, one byte per 63 steps or part of them
+            size_t bytes = 4 * ((steps + 62) / 63);
+            CHECK(CompactPath(cells).memoryUsage() <= sizeof(CompactPath) + bytes + 64);
+        }
+    }
+
+    // Theta* turning points are any distance apart and must be escaped
+    void testEscapedOffsets()
+    {
+        checkRoundTrip({{0, 0}, {3, 4}, {3, 5}, {-7, 100}, {-7, 101}, {-7, 102}, {2000000, -2000000}, {0, 0}});
+
+        // Offsets around the LEB128 byte boundaries, in both signs
+        for (int offset : {2, 63, 64, 65, 127, 128, 8191, 8192, 1 << 20, (1 << 28) + 3})
+        {
+            checkRoundTrip({{0, 0}, {offset, 0}, {offset, -offset}, {0, -offset}, {0, 0}});
+        }
+
+        // Standing still and diagonal moves are escaped too
+        checkRoundTrip({{1, 1}, {1, 1}, {2, 2}, {2, 3}, {1, 2}});
+    }
+
+    // A run must not continue across an escaped move in the same direction
+    void testRunAfterEscape()
+    {
+        Positions cells = {{10, 10}};
+        appendRun(cells, 0, 1, 5);
+        cells.emplace_back(10, 30);
+        appendRun(cells, 0, 1, 70);
+        checkRoundTrip(cells);
+    }
+
+    // A deterministic random walk mixing single steps and jumps
+    void testRandomWalks()
+    {
+        uint32_t state = 12345;
+        auto next = [&]()
+        {
+            state = state * 1664525u + 1013904223u;
+            return state >> 8;
+        };
+
+        for (int walk = 0; walk < 50; ++walk)
+        {
+            Positions cells = {{0, 0}};
+            for (int i = 0; i < 500; ++i)
+            {
+                if (next() % 20 == 0)
+                {
+                    cells.emplace_back(cells.back().first + int(next() % 2001) - 1000, cells.back().second + int(next() % 2001) - 1000);
+                }
+                else
+                {
+                    static const int dRow[4] = {-1, 1, 0, 0};
+                    static const int dCol[4] = {0, 0, -1, 1};
+                    int d = next() % 4;
+                    appendRun(cells, dRow[d], dCol[d], 1 + next() % 80);
+                }
+            }
+            checkRoundTrip(cells);
+        }
+    }
+
+    void testClearAndReuse()
+    {
+        Positions cells = {{0, 0}};
+        appendRun(cells, 1, 0, 100);
+
+        CompactPath path(cells);
+        path.clear();
+        CHECK(path.empty());
+
+        path.push_back(4, 4);
+        path.push_back(4, 5);
+        CHECK(path.toPositions() == Positions({{4, 4}, {4, 5}}));
+    }
+}
+
+int main()
+{
+    testEmptyAndSingle();
+    testLongRuns();
+    testEscapedOffsets();
+    testRunAfterEscape();
+    testRandomWalks();
+    testClearAndReuse();
+    return test::report("CompactPathTest");
+}
\ No newline at end of file
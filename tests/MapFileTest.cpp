@@ -0,0 +1,204 @@
+#include "Check.h"
+#include "../MapFile.h"
+#include "../MapGenerator.h"
+#include "../PathService.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    const char *PATH = "MapFileTest.pfm";
+
+    typedef std::vector<std::vector<Node>> Grid;
+
+    std::vector<char> readFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string &path, const std::vector<char> &bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    MapFile::Header readHeader(const std::vector<char> &bytes)
+    {
+        MapFile::Header header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        return header;
+    }
+
+    // The saved bytes with the header changed by edit
+    template <typename Edit>
+    std::vector<char> withHeader(std::vector<char> bytes, Edit &&edit)
+    {
+        MapFile::Header header = readHeader(bytes);
+        edit(header);
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        return bytes;
+    }
+
+    bool opens(const std::vector<char> &bytes)
+    {
+        writeFile(PATH, bytes);
+        MapFile file;
+        return file.open(PATH);
+    }
+
+    Grid makeGrid(int rows, int cols, MapStyle style, uint64_t seed, float density = 0.3f)
+    {
+        Grid grid(rows, std::vector<Node>(cols));
+        generateMap(grid, style, seed, density);
+        return grid;
+    }
+
+    // Save, open and compare every cell, then copy back into nodes and into a SearchGrid
+    void checkRoundTrip(const Grid &grid, bool expectRLE, const std::vector<uint8_t> *costs = nullptr)
+    {
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+
+        CHECK(MapFile::save(PATH, grid, costs));
+        CHECK(MapFile::isMapFile(PATH));
+        CHECK(bool(readHeader(readFile(PATH)).flags & MapFile::WallsRLE) == expectRLE);
+
+        MapFile file;
+        CHECK(file.open(PATH));
+        CHECK(file.rows() == rows);
+        CHECK(file.cols() == cols);
+        CHECK(file.hasCosts() == (costs != nullptr));
+
+        int starts = 0;
+        int goals = 0;
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int col = 0; col < cols; ++col)
+            {
+                CHECK(file.isWall(row, col) == (grid[row][col].type == Node::NodeType::Wall));
+                if (costs)
+                    CHECK(file.cost(row, col) == (*costs)[row * cols + col]);
+                starts += grid[row][col].type == Node::NodeType::Start;
+                goals += grid[row][col].type == Node::NodeType::End;
+            }
+        }
+        CHECK(file.startCount() == starts);
+        CHECK(file.goalCount() == goals);
+
+        Grid copy(rows, std::vector<Node>(cols));
+        file.toGrid(copy);
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int col = 0; col < cols; ++col)
+            {
+                CHECK(copy[row][col].type == grid[row][col].type);
+            }
+        }
+
+        // The service's SearchGrid is built from the file without nodes, with the same clearance
+        SearchGrid fromFile;
+        CHECK(PathService::loadMap(PATH, fromFile));
+        SearchGrid fromNodes(grid);
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int col = 0; col < cols; ++col)
+            {
+                int id = fromNodes.getLayout().index(row, col);
+                for (int size = 1; size <= 4; ++size)
+                {
+                    CHECK(fromFile.isWalkable(id, size) == fromNodes.isWalkable(id, size));
+                }
+            }
+        }
+    }
+
+    // Dense random walls don't compress, a mostly empty field does
+    void testRoundTrips()
+    {
+        checkRoundTrip(makeGrid(37, 53, MapStyle::Obstacles, 1, 0.5f), false);
+        checkRoundTrip(makeGrid(64, 64, MapStyle::Maze, 2), false);
+        checkRoundTrip(makeGrid(80, 45, MapStyle::OpenField, 3), true);
+        checkRoundTrip(makeGrid(50, 70, MapStyle::Rooms, 4), true);
+
+        Grid grid = makeGrid(20, 30, MapStyle::OpenField, 5);
+        std::vector<uint8_t> costs(20 * 30);
+        for (size_t i = 0; i < costs.size(); ++i)
+        {
+            costs[i] = uint8_t(i * 7);
+        }
+        checkRoundTrip(grid, true, &costs);
+    }
+
+    void testTruncated()
+    {
+        for (bool rle : {false, true})
+        {
+            Grid grid = makeGrid(40, 40, rle ? MapStyle::OpenField : MapStyle::Obstacles, 6, 0.5f);
+            CHECK(MapFile::save(PATH, grid));
+            std::vector<char> bytes = readFile(PATH);
+            CHECK(opens(bytes));
+
+            // The goals come last and fill their section exactly, so every byte counts
+            for (size_t size = 0; size < bytes.size(); size += size < sizeof(MapFile::Header) + 16 ? 1 : 5)
+            {
+                CHECK(!opens(std::vector<char>(bytes.begin(), bytes.begin() + size)));
+            }
+            CHECK(!opens(std::vector<char>(bytes.begin(), bytes.end() - 1)));
+        }
+    }
+
+    void testCorruptHeaders()
+    {
+        Grid grid = makeGrid(40, 40, MapStyle::OpenField, 7);
+        CHECK(MapFile::save(PATH, grid));
+        const std::vector<char> rle = readFile(PATH);
+        CHECK(readHeader(rle).flags & MapFile::WallsRLE);
+
+        grid = makeGrid(40, 40, MapStyle::Obstacles, 7, 0.5f);
+        CHECK(MapFile::save(PATH, grid));
+        const std::vector<char> bitset = readFile(PATH);
+        CHECK(!(readHeader(bitset).flags & MapFile::WallsRLE));
+
+        for (const std::vector<char> *bytes : {&rle, &bitset})
+        {
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.magic[0] = 'X'; })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { ++header.version; })));
+
+            // Sizes that would need gigabytes are refused before anything is allocated
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.rows = header.cols = 0xFFFFFFFFu; })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.rows = 1u << 15; header.cols = 1u << 14; })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.rows = 0x80000000u; header.cols = 1; })));
+
+            // Sections that don't match the size of the map or of the file
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.wallBytes = ~uint64_t(0); })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { ++header.rows; })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.goalCount += 1000; })));
+            CHECK(!opens(withHeader(*bytes, [](MapFile::Header &header) { header.flags |= MapFile::HasCosts; })));
+        }
+
+        // The bitset must be exactly one bit per cell
+        CHECK(!opens(withHeader(bitset, [](MapFile::Header &header) { header.wallBytes -= 8; })));
+
+        // Run lengths that don't add up to the number of cells
+        CHECK(!opens(withHeader(rle, [](MapFile::Header &header) { --header.cols; })));
+
+        // A start outside the map
+        std::vector<char> outside = rle;
+        const MapFile::Header header = readHeader(rle);
+        size_t startOffset = outside.size() - (header.startCount + header.goalCount) * sizeof(MapFile::Cell);
+        MapFile::Cell cell = {header.rows, 0};
+        std::memcpy(outside.data() + startOffset, &cell, sizeof(cell));
+        CHECK(!opens(outside));
+    }
+}
+
+int main()
+{
+    testRoundTrips();
+    testTruncated();
+    testCorruptHeaders();
+    std::remove(PATH);
+    return test::report("MapFileTest");
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "Check.h"
+#include "../PathCache.h"
+#include "../PathService.h"
+#include "../MapGenerator.h"
+#include <cstdlib>
+#include <queue>
+#include <sstream>
+
+namespace
+{
+    PathCache::Key key(int algorithm, int startRow, int startCol, int endRow, int endCol, int agentSize = 1)
+    {
+        return PathCache::Key{algorithm, startRow, startCol, endRow, endCol, agentSize};
+    }
+
+    CompactPath straightPath(int row, int fromCol, int toCol)
+    {
+        CompactPath path;
+        for (int col = fromCol; col <= toCol; ++col)
+        {
+            path.push_back(row, col);
+        }
+        return path;
+    }
+
+    // A new wall drops the paths through its region and no other
+    void testAddedWall()
+    {
+        PathCache cache(16, 16);
+        cache.insert(key(0, 2, 0, 2, 40), straightPath(2, 0, 40), true);
+        cache.insert(key(0, 40, 0, 40, 10), straightPath(40, 0, 10), true);
+
+        cache.invalidate(5, 20); // Region (0, 1), crossed by the first path only
+        CHECK(cache.find(key(0, 2, 0, 2, 40)) == nullptr);
+        CHECK(cache.find(key(0, 40, 0, 40, 10)) != nullptr);
+        CHECK(cache.getInvalidations() == 1);
+
+        cache.invalidate(100, 100); // Nothing there
+        CHECK(cache.size() == 1);
+        CHECK(cache.getInvalidations() == 1);
+    }
+
+    // A 2 x 2 agent walking along row 15 also covers row 16, the next row of regions
+    void testAgentFootprint()
+    {
+        PathCache cache(16, 16);
+        cache.insert(key(0, 15, 0, 15, 10, 2), straightPath(15, 0, 10), true);
+        cache.insert(key(0, 15, 0, 15, 10, 1), straightPath(15, 0, 10), true);
+
+        cache.invalidate(16, 3);
+        CHECK(cache.find(key(0, 15, 0, 15, 10, 2)) == nullptr);
+        CHECK(cache.find(key(0, 15, 0, 15, 10, 1)) != nullptr);
+    }
+
+    // A removed wall only drops optimal paths that a shortcut could make shorter
+    void testRemovedWall()
+    {
+        PathCache cache(16, 16);
+
+        CompactPath detour = straightPath(0, 0, 4);
+        detour.push_back(1, 4);
+        detour.push_back(1, 3);
+        cache.insert(key(0, 0, 0, 1, 3), detour, true);                  // 6 steps for a Manhattan distance of 4
+        cache.insert(key(0, 5, 0, 5, 9), straightPath(5, 0, 9), true);  // Already as short as it gets
+        cache.insert(key(1, 0, 0, 1, 3), detour, false);                 // Not a shortest path search
+
+        cache.invalidateShortcuts();
+        CHECK(cache.find(key(0, 0, 0, 1, 3)) == nullptr);
+        CHECK(cache.find(key(0, 5, 0, 5, 9)) != nullptr);
+        CHECK(cache.find(key(1, 0, 0, 1, 3)) != nullptr);
+        CHECK(cache.getInvalidations() == 1);
+    }
+
+    void testEviction()
+    {
+        PathCache cache(2, 16);
+        cache.insert(key(0, 0, 0, 0, 1), straightPath(0, 0, 1), true);
+        cache.insert(key(0, 1, 0, 1, 1), straightPath(1, 0, 1), true);
+        CHECK(cache.find(key(0, 0, 0, 0, 1)) != nullptr); // Now the most recently used
+
+        cache.insert(key(0, 2, 0, 2, 1), straightPath(2, 0, 1), true);
+        CHECK(cache.size() == 2);
+        CHECK(cache.find(key(0, 1, 0, 1, 1)) == nullptr);
+        CHECK(cache.find(key(0, 0, 0, 0, 1)) != nullptr);
+        CHECK(cache.find(key(0, 2, 0, 2, 1)) != nullptr);
+    }
+
+    // Steps on a shortest path, -1 if there is none
+    int shortestSteps(const std::vector<std::vector<char>> &walls, int startRow, int startCol, int goalRow, int goalCol)
+    {
+        const int rows = walls.size();
+        const int cols = walls[0].size();
+        std::vector<int> distance(rows * cols, -1);
+        std::queue<int> open;
+        distance[startRow * cols + startCol] = 0;
+        open.push(startRow * cols + startCol);
+
+        while (!open.empty())
+        {
+            int id = open.front();
+            open.pop();
+            const int dRow[4] = {-1, 1, 0, 0};
+            const int dCol[4] = {0, 0, -1, 1};
+            for (int d = 0; d < 4; ++d)
+            {
+                int row = id / cols + dRow[d];
+                int col = id % cols + dCol[d];
+                if (row >= 0 && row < rows && col >= 0 && col < cols && !walls[row][col] && distance[row * cols + col] == -1)
+                {
+                    distance[row * cols + col] = distance[id] + 1;
+                    open.push(row * cols + col);
+                }
+            }
+        }
+        return distance[goalRow * cols + goalCol];
+    }
+
+    // The same few queries asked again and again between random wall edits: the service must
+    // answer from its cache when it can, and never with a path an edit made wrong
+    void testServiceEdits()
+    {
+        const int rows = 48;
+        const int cols = 48;
+        std::vector<std::vector<Node>> nodes(rows, std::vector<Node>(cols));
+        generateMap(nodes, MapStyle::Obstacles, 33, 0.2f);
+
+        std::vector<std::vector<char>> walls(rows, std::vector<char>(cols));
+        for (int row = 0; row < rows; ++row)
+            for (int col = 0; col < cols; ++col)
+                walls[row][col] = nodes[row][col].type == Node::NodeType::Wall;
+
+        PathService service(SearchGrid(rows, cols, [&](int row, int col) { return bool(walls[row][col]); }));
+
+        MapRandom random(33);
+        const char *algorithms[] = {"bfs", "dijkstra", "astar", "subgoal"};
+        std::vector<std::pair<int, int>> ends;
+        for (int i = 0; i < 8; ++i)
+        {
+            ends.emplace_back(random.below(rows), random.below(cols));
+        }
+
+        long long checked = 0;
+        for (int round = 0; round < 300; ++round)
+        {
+            int row = random.below(rows);
+            int col = random.below(cols);
+            bool wall = random.below(3) != 0 ? !walls[row][col] : false;
+            walls[row][col] = wall;
+            std::ostringstream edit;
+            edit << "{\"op\": \"set\", \"row\": " << row << ", \"col\": " << col << ", \"wall\": " << (wall ? "true" : "false") << "}";
+            service.handleRound({edit.str()});
+
+            for (size_t i = 0; i + 1 < ends.size(); i += 2)
+            {
+                auto start = ends[i];
+                auto goal = ends[i + 1];
+                if (walls[start.first][start.second] || walls[goal.first][goal.second])
+                    continue;
+
+                const char *algorithm = algorithms[(round + i / 2) % 4];
+                std::ostringstream query;
+                query << "{\"op\": \"path\", \"algorithm\": \"" << algorithm << "\", \"start\": [" << start.first << ", "
+                      << start.second << "], \"goal\": [" << goal.first << ", " << goal.second << "]}";
+                std::string response = service.handleRound({query.str()})[0];
+
+                int expected = shortestSteps(walls, start.first, start.second, goal.first, goal.second);
+                bool found = response.find("\"found\": true") != std::string::npos;
+                CHECK(found == (expected != -1));
+                if (!found || expected == -1)
+                    continue;
+
+                size_t length = response.find("\"length\": ");
+                CHECK(length != std::string::npos && std::atoi(response.c_str() + length + 10) == expected);
+
+                // Every cell of the answer is free on the current map
+                std::istringstream cells(response.substr(response.find("\"path\": [") + 9));
+                char bracket, comma;
+                int cellRow, cellCol;
+                while (cells >> bracket && bracket == '[' && cells >> cellRow >> comma >> cellCol >> bracket)
+                {
+                    CHECK(!walls[cellRow][cellCol]);
+                    cells >> comma;
+                }
+                ++checked;
+            }
+        }
+
+        std::string stats = service.handleRound({"{\"op\": \"stats\"}"})[0];
+        size_t hits = stats.find("\"hits\": ");
+        size_t invalidations = stats.find("\"invalidations\": ");
+        CHECK(checked > 100);
+        CHECK(hits != std::string::npos && std::atoi(stats.c_str() + hits + 8) > 0);
+        CHECK(invalidations != std::string::npos && std::atoi(stats.c_str() + invalidations + 17) > 0);
+    }
+}
+
+int main()
+{
+    testAddedWall();
+    testAgentFootprint();
+    testRemovedWall();
+    testEviction();
+    testServiceEdits();
+    return test::report("PathCacheTest");
+}
\ No newline at end of file
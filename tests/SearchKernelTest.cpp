@@ -0,0 +1,186 @@
+#include "Check.h"
+#include "../SearchKernel.h"
+#include "../IndexedHeap.h"
+#include "../MapGenerator.h"
+#include <algorithm>
+#include <queue>
+
+namespace
+{
+    typedef std::vector<std::vector<Node>> Grid;
+    typedef std::vector<std::pair<int, int>> Cells;
+
+    // Plain BFS over the clearance layer, independent of the kernel: the number of cells on a
+    // shortest path to the nearest goal the agent fits on, 0 if there is none
+    size_t shortestCells(const Grid &grid, const Position &start, const std::vector<Position> &goals, int agentSize)
+    {
+        const int rows = grid.size();
+        const int cols = grid[0].size();
+        std::vector<int> distance(rows * cols, -1);
+        std::queue<int> open;
+
+        distance[start.row * cols + start.col] = 0;
+        open.push(start.row * cols + start.col);
+        while (!open.empty())
+        {
+            int id = open.front();
+            open.pop();
+
+            const int dRow[4] = {-1, 1, 0, 0};
+            const int dCol[4] = {0, 0, -1, 1};
+            for (int d = 0; d < 4; ++d)
+            {
+                int row = id / cols + dRow[d];
+                int col = id % cols + dCol[d];
+                if (row < 0 || row >= rows || col < 0 || col >= cols || grid[row][col].clearance < agentSize ||
+                    distance[row * cols + col] != -1)
+                    continue;
+
+                distance[row * cols + col] = distance[id] + 1;
+                open.push(row * cols + col);
+            }
+        }
+
+        int best = -1;
+        for (const Position &goal : goals)
+        {
+            int d = distance[goal.row * cols + goal.col];
+            if (d != -1 && (best == -1 || d < best))
+                best = d;
+        }
+        return best == -1 ? 0 : best + 1;
+    }
+
+    // From the start to one of the goals in single steps over cells the agent fits on
+    bool isValidPath(const Grid &grid, const Cells &path, const Position &start, const std::vector<Position> &goals, int agentSize)
+    {
+        if (path.empty() || path.front() != std::make_pair(start.row, start.col))
+            return false;
+
+        bool endsAtGoal = false;
+        for (const Position &goal : goals)
+            endsAtGoal = endsAtGoal || path.back() == std::make_pair(goal.row, goal.col);
+
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (grid[path[i].first][path[i].second].clearance < agentSize)
+                return false;
+            if (i > 0 && std::abs(path[i].first - path[i - 1].first) + std::abs(path[i].second - path[i - 1].second) != 1)
+                return false;
+        }
+        return endsAtGoal;
+    }
+
+    template <typename Layout, typename OpenList, typename Heuristic, typename EarlyExit>
+    Cells searchLayout(Grid &grid, const Position &start, const std::vector<Position> &goals, int agentSize)
+    {
+        BasicSearchGrid<Layout> searchGrid(grid);
+        Pathfinder pathfinder(grid, start, goals, agentSize);
+        searchKernelOn<OpenList, Heuristic, FourConnected, UnitCost, EarlyExit>(pathfinder, SearchGridView<Layout>{searchGrid, agentSize});
+        return Cells(pathfinder.pathPositions.begin(), pathfinder.pathPositions.end());
+    }
+
+    // The optimal searches in every layout against the reference, DFS only for a valid path
+    template <typename Layout>
+    void checkLayout(Grid &grid, const Position &start, const std::vector<Position> &goals, int agentSize, size_t expected)
+    {
+        Cells bfs = searchLayout<Layout, FifoOpenList, ZeroHeuristic, ExitOnGenerate>(grid, start, goals, agentSize);
+        Cells dijkstra = searchLayout<Layout, PriorityOpenList, ZeroHeuristic, ExitOnGenerate>(grid, start, goals, agentSize);
+        Cells astar = searchLayout<Layout, PriorityOpenList, NearestGoalHeuristic, ExitOnExpand>(grid, start, goals, agentSize);
+        Cells dfs = searchLayout<Layout, LifoOpenList, ZeroHeuristic, ExitOnGenerate>(grid, start, goals, agentSize);
+
+        CHECK(bfs.size() == expected);
+        CHECK(dijkstra.size() == expected);
+        CHECK(astar.size() == expected);
+        CHECK(dfs.empty() == (expected == 0));
+
+        if (expected != 0)
+        {
+            CHECK(isValidPath(grid, bfs, start, goals, agentSize));
+            CHECK(isValidPath(grid, dijkstra, start, goals, agentSize));
+            CHECK(isValidPath(grid, astar, start, goals, agentSize));
+            CHECK(isValidPath(grid, dfs, start, goals, agentSize));
+        }
+    }
+
+    // Generated maps with up to 40 goals, past the few that the heuristic checks one by one
+    void testMultipleGoals()
+    {
+        MapRandom random(29);
+        for (int map = 0; map < 48; ++map)
+        {
+            int rows = 2 + random.below(90);
+            int cols = 2 + random.below(90);
+            Grid grid(rows, std::vector<Node>(cols));
+            generateMap(grid, MapStyle(map % MAP_STYLE_COUNT), map);
+
+            Pathfinder flags(grid);
+            if (flags.startRow < 0)
+                continue;
+            Position start(flags.startRow, flags.startCol);
+
+            std::vector<Position> goals = flags.endNodes;
+            int extraGoals = random.below(40);
+            for (int i = 0; i < extraGoals; ++i)
+            {
+                Position goal(random.below(rows), random.below(cols));
+                if (grid[goal.row][goal.col].type != Node::NodeType::Wall && (goal.row != start.row || goal.col != start.col))
+                    goals.push_back(goal);
+            }
+
+            for (int agentSize = 1; agentSize <= 2; ++agentSize)
+            {
+                if (grid[start.row][start.col].clearance < agentSize)
+                    continue;
+
+                size_t expected = shortestCells(grid, start, goals, agentSize);
+
+                // The algorithms as the editor runs them, on the nodes
+                CHECK(BFS(grid, start, goals, agentSize).pathPositions.size() == expected);
+                CHECK(Dijkstra(grid, start, goals, agentSize).pathPositions.size() == expected);
+                CHECK(Astar(grid, start, goals, 1.0f, agentSize).pathPositions.size() == expected);
+
+                checkLayout<RowMajorLayout>(grid, start, goals, agentSize, expected);
+                checkLayout<MortonLayout>(grid, start, goals, agentSize, expected);
+            }
+        }
+    }
+
+    // Keys lowered many times must still come out in order, each id once
+    void testIndexedHeap()
+    {
+        MapRandom random(7);
+        const int count = 1000;
+        IndexedHeap<int> heap(count);
+        std::vector<int> keys(count, INT_MAX);
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            int id = random.below(count);
+            int key = random.below(100000);
+            heap.push(id, key);
+            keys[id] = std::min(keys[id], key);
+        }
+
+        int previous = -1;
+        int popped = 0;
+        while (!heap.empty())
+        {
+            int key = heap.topKey();
+            int id = heap.pop();
+            CHECK(key == keys[id]);
+            CHECK(key >= previous);
+            previous = key;
+            keys[id] = -1;
+            ++popped;
+        }
+        CHECK(popped == count - int(std::count(keys.begin(), keys.end(), INT_MAX)));
+    }
+}
+
+int main()
+{
+    testMultipleGoals();
+    testIndexedHeap();
+    return test::report("SearchKernelTest");
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "Check.h"
+#include "../SubgoalGraph.h"
+#include "../Pathfinder.h"
+#include "../MapGenerator.h"
+
+namespace
+{
+    typedef std::vector<std::vector<Node>> Grid;
+
+    bool isValidPath(const std::pmr::vector<std::pair<int, int>> &path, const Grid &grid, const Position &start)
+    {
+        if (path.empty() || path.front() != std::make_pair(start.row, start.col))
+            return false;
+
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (grid[path[i].first][path[i].second].type == Node::NodeType::Wall)
+                return false;
+            if (i > 0 && std::abs(path[i].first - path[i - 1].first) + std::abs(path[i].second - path[i - 1].second) != 1)
+                return false;
+        }
+        return true;
+    }
+
+    // A few random goals besides the generated one, never on a wall or the start
+    std::vector<Position> pickGoals(const Grid &grid, const Position &start, MapRandom &random)
+    {
+        std::vector<Position> goals;
+        int count = 1 + random.below(12);
+        for (int i = 0; i < count * 4 && int(goals.size()) < count; ++i)
+        {
+            Position goal(random.below(grid.size()), random.below(grid[0].size()));
+            if (grid[goal.row][goal.col].type != Node::NodeType::Wall && (goal.row != start.row || goal.col != start.col))
+                goals.push_back(goal);
+        }
+        return goals;
+    }
+
+    // Paint and erase walls one at a time, keeping the graph up to date with update() only, and
+    // compare every query with A* on the same nodes
+    void testIncrementalEdits()
+    {
+        MapRandom random(42);
+        for (int map = 0; map < 24; ++map)
+        {
+            int rows = 8 + random.below(50);
+            int cols = 8 + random.below(50);
+            Grid grid(rows, std::vector<Node>(cols));
+            generateMap(grid, MapStyle(map % MAP_STYLE_COUNT), map);
+
+            // The graph of the nodes, and one of a SearchGrid without nodes edited with setWall,
+            // like the service's
+            SubgoalGraph graph(grid);
+            SearchGrid searchGrid(rows, cols, [&](int row, int col) { return grid[row][col].type == Node::NodeType::Wall; });
+            SubgoalGraph gridGraph(searchGrid);
+
+            for (int edit = 0; edit < 60; ++edit)
+            {
+                int row = random.below(rows);
+                int col = random.below(cols);
+                Node &node = grid[row][col];
+                if (node.type != Node::NodeType::Empty && node.type != Node::NodeType::Wall)
+                    continue;
+
+                bool wall = node.type == Node::NodeType::Empty;
+                node.type = wall ? Node::NodeType::Wall : Node::NodeType::Empty;
+                updateClearance(grid, row, col);
+                graph.update(row, col);
+                searchGrid.setWall(row, col, wall);
+                gridGraph.update(row, col);
+
+                Position start(random.below(rows), random.below(cols));
+                if (grid[start.row][start.col].type == Node::NodeType::Wall)
+                    continue;
+                std::vector<Position> goals = pickGoals(grid, start, random);
+                if (goals.empty())
+                    continue;
+
+                Astar astar(grid, start, goals);
+                auto path = graph.findPath(start, goals);
+                auto gridPath = gridGraph.findPath(start, goals);
+
+                CHECK(path.size() == astar.pathPositions.size());
+                CHECK(gridPath.size() == astar.pathPositions.size());
+                if (!path.empty())
+                {
+                    CHECK(isValidPath(path, grid, start));
+                    CHECK(isValidPath(gridPath, grid, start));
+                }
+            }
+
+            // After all the edits, the same subgoals and links as a graph built from scratch
+            SubgoalGraph rebuilt(grid);
+            CHECK(graph.getSubgoalCount() == rebuilt.getSubgoalCount());
+            CHECK(graph.getEdgeCount() == rebuilt.getEdgeCount());
+            CHECK(gridGraph.getSubgoalCount() == rebuilt.getSubgoalCount());
+            CHECK(gridGraph.getEdgeCount() == rebuilt.getEdgeCount());
+        }
+    }
+}
+
+int main()
+{
+    testIncrementalEdits();
+    return test::report("SubgoalGraphTest");
+}
\ No newline at end of file